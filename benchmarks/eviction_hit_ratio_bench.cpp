@@ -0,0 +1,254 @@
+/**
+ * @file eviction_hit_ratio_bench.cpp
+ * @brief Compares the hit ratio of the eviction policies on synthetic
+ *        cache traces.
+ *
+ * Usage : bench_eviction_hit_ratio [keys] [cache_percent]   (default 200,000, 10)
+ *
+ * Each trace is replayed against a KVEngine whose memory limit holds about
+ * cache_percent of the key space, as a cache-aside client would: GET, and
+ * SET on a miss. Eviction runs inline whenever usage crosses the high
+ * watermark, as the background Evictor would. Hits are counted after the
+ * first kWarmupPercent of the trace.
+ *
+ * Traces :
+ *  - zipf   Keys drawn from Zipf(0.99).
+ *  - scan   The same Zipf traffic with one-off sequential scans over cold
+ *           keys mixed in (kScanPercent of requests, kScanLength keys each),
+ *           which pollute a pure recency order.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/kv_engine.h"
+#include "eviction/sampled_lru_policy.h"
+#include "eviction/tiny_lfu_policy.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using kvmemo::core::AccessTracking;
+    using kvmemo::core::KVEngine;
+    using kvmemo::core::ShardManager;
+    using kvmemo::eviction::EvictionManager;
+    using kvmemo::eviction::MemoryTracker;
+
+    constexpr std::size_t kShards = 8;
+    constexpr std::size_t kOpsPerKey = 10;
+    constexpr std::size_t kWarmupPercent = 10;
+    constexpr std::size_t kScanPercent = 20;
+    constexpr std::size_t kScanLength = 1000;
+
+    struct Policy
+    {
+        const char *name;
+        AccessTracking tracking;
+        EvictionManager::PolicyFactory make;
+    };
+
+    struct Result
+    {
+        double hit_ratio;
+        double mops;
+    };
+
+    std::vector<std::uint32_t> ZipfTrace(std::size_t keys, std::size_t ops, std::uint32_t seed)
+    {
+        std::vector<double> cdf(keys);
+        double sum = 0;
+        for (std::size_t i = 0; i < keys; ++i)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), 0.99);
+            cdf[i] = sum;
+        }
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(0, sum);
+
+        // Ranks are scattered over the key space so hot keys do not share
+        // a shard or a scan range.
+        std::vector<std::uint32_t> permutation(keys);
+        for (std::size_t i = 0; i < keys; ++i)
+        {
+            permutation[i] = static_cast<std::uint32_t>(i);
+        }
+        std::shuffle(permutation.begin(), permutation.end(), rng);
+
+        std::vector<std::uint32_t> trace(ops);
+        for (auto &key : trace)
+        {
+            const auto rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+            key = permutation[static_cast<std::size_t>(rank)];
+        }
+        return trace;
+    }
+
+    /**
+     * @brief Zipf traffic with sequential scans over keys it never asks
+     *        for (the key space is extended by 50% for them).
+     */
+    std::vector<std::uint32_t> ScanTrace(std::size_t keys, std::size_t ops, std::uint32_t seed)
+    {
+        const std::vector<std::uint32_t> zipf = ZipfTrace(keys, ops, seed);
+        const std::size_t scan_keys = keys / 2;
+
+        // A scan starts with the probability that makes scans
+        // kScanPercent of all requests.
+        const double share = kScanPercent / 100.0;
+        std::bernoulli_distribution starts_scan(share / (kScanLength * (1 - share) + share));
+
+        std::mt19937 rng(seed + 1);
+        std::vector<std::uint32_t> trace;
+        trace.reserve(ops);
+
+        std::size_t next = 0;
+        while (trace.size() < ops)
+        {
+            if (starts_scan(rng))
+            {
+                const std::size_t start = rng() % (scan_keys - kScanLength);
+                for (std::size_t i = 0; i < kScanLength && trace.size() < ops; ++i)
+                {
+                    trace.push_back(static_cast<std::uint32_t>(keys + start + i));
+                }
+            }
+            else
+            {
+                trace.push_back(zipf[next++]);
+            }
+        }
+        return trace;
+    }
+
+    /**
+     * @brief Bytes the engine charges for one key of the trace.
+     */
+    std::size_t BytesPerKey(const std::vector<std::string> &keys, const std::string &value)
+    {
+        constexpr std::size_t kProbe = 10'000;
+
+        KVEngine engine(std::make_unique<ShardManager>(1, kProbe * 2),
+                        std::make_unique<EvictionManager>(
+                            std::make_unique<MemoryTracker>(std::size_t{1} << 40),
+                            []
+                            { return std::make_unique<kvmemo::eviction::NoEvictionPolicy>(); }));
+        for (std::size_t i = 0; i < kProbe; ++i)
+        {
+            engine.Set(keys[i], value);
+        }
+        return engine.MemoryUsage().Total() / kProbe;
+    }
+
+    Result Run(const Policy &policy,
+               std::size_t max_memory,
+               const std::vector<std::string> &keys,
+               const std::vector<std::uint32_t> &trace,
+               const std::string &value)
+    {
+        KVEngine engine(std::make_unique<ShardManager>(kShards,
+                                                       std::numeric_limits<std::size_t>::max(),
+                                                       kvmemo::core::ReadMode::kShared,
+                                                       policy.tracking),
+                        std::make_unique<EvictionManager>(
+                            std::make_unique<MemoryTracker>(max_memory, 90, 80, kShards),
+                            policy.make,
+                            kShards));
+
+        const std::size_t warmup = trace.size() * kWarmupPercent / 100;
+        std::size_t hits = 0;
+
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < trace.size(); ++i)
+        {
+            const std::string &key = keys[trace[i]];
+            if (engine.GetShared(key).has_value())
+            {
+                hits += i >= warmup ? 1 : 0;
+                continue;
+            }
+
+            engine.Set(key, value);
+            if (engine.NeedsEviction())
+            {
+                engine.ProcessEvictions();
+            }
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        return Result{static_cast<double>(hits) / static_cast<double>(trace.size() - warmup),
+                      static_cast<double>(trace.size()) / seconds / 1e6};
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200'000;
+    const std::size_t cache_percent = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+
+    // The scan trace reads another count / 2 keys after the Zipf range.
+    std::vector<std::string> keys;
+    keys.reserve(count + count / 2);
+    for (std::size_t i = 0; i < count + count / 2; ++i)
+    {
+        keys.push_back("key:" + std::to_string(i));
+    }
+
+    const std::string value(64, 'v');
+    const std::size_t ops = count * kOpsPerKey;
+    // Usage settles between the watermarks; aim the low one at the target.
+    const std::size_t max_memory = BytesPerKey(keys, value) * count * cache_percent / 100 * 100 / 85;
+
+    const std::vector<Policy> policies = {
+        {"lru", AccessTracking::kOrdered, []
+         { return std::make_unique<kvmemo::eviction::LRUPolicy>(); }},
+        {"sampled-lru/5", AccessTracking::kSampled, []
+         { return std::make_unique<kvmemo::eviction::SampledLRUPolicy>(5); }},
+        {"sampled-lru/10", AccessTracking::kSampled, []
+         { return std::make_unique<kvmemo::eviction::SampledLRUPolicy>(10); }},
+        {"tinylfu", AccessTracking::kSampled, []
+         { return std::make_unique<kvmemo::eviction::TinyLFUPolicy>(); }},
+        {"lfu", AccessTracking::kSampled, []
+         { return std::make_unique<kvmemo::eviction::LFUPolicy>(); }},
+    };
+
+    const std::vector<std::pair<const char *, std::vector<std::uint32_t>>> traces = {
+        {"zipf", ZipfTrace(count, ops, 7)},
+        {"scan", ScanTrace(count, ops, 7)},
+    };
+
+    std::printf("%zu keys, cache ~%zu%%, %zu requests per trace, 64-byte values\n",
+                count, cache_percent, ops);
+    std::printf("%-16s %-6s %10s %12s\n", "policy", "trace", "hit ratio", "Mops/s");
+
+    for (const auto &policy : policies)
+    {
+        for (const auto &[name, trace] : traces)
+        {
+            const Result result = Run(policy, max_memory, keys, trace, value);
+            std::printf("%-16s %-6s %9.2f%% %12.2f\n", policy.name, name, result.hit_ratio * 100, result.mops);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
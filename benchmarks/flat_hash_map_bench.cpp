@@ -0,0 +1,145 @@
+/**
+ * @file flat_hash_map_bench.cpp
+ * @brief Compares core::FlatHashMap with std::unordered_map as the shard
+ *        store: SET / GET throughput and heap bytes per key.
+ *
+ * Usage : bench_flat_hash_map [keys]      (default 10,000,000)
+ *
+ * Keys are "key:<n>" strings short enough for the small-string buffer,
+ * so the byte counts measure the table itself rather than key storage.
+ * Heap usage is tracked with a counting global operator new.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/entry.h"
+#include "core/flat_hash_map.h"
+
+namespace
+{
+    std::atomic<std::size_t> g_live_bytes{0};
+}
+
+void *operator new(std::size_t size)
+{
+    void *ptr = std::malloc(size + sizeof(std::max_align_t));
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *static_cast<std::size_t *>(ptr) = size;
+    g_live_bytes.fetch_add(size, std::memory_order_relaxed);
+    return static_cast<char *>(ptr) + sizeof(std::max_align_t);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    void *base = static_cast<char *>(ptr) - sizeof(std::max_align_t);
+    g_live_bytes.fetch_sub(*static_cast<std::size_t *>(base), std::memory_order_relaxed);
+    std::free(base);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Entry = kvmemo::core::Entry;
+
+    double MopsPerSec(std::size_t ops, Clock::time_point start)
+    {
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return static_cast<double>(ops) / seconds / 1e6;
+    }
+
+    template <typename Map>
+    void Run(const char *name, const std::vector<std::string> &keys, const std::vector<std::uint32_t> &order)
+    {
+        const std::size_t before = g_live_bytes.load();
+        std::size_t hits = 0;
+
+        {
+            Map store;
+
+            auto start = Clock::now();
+            for (const auto &key : keys)
+            {
+                store[key] = Entry(std::string());
+            }
+            const double set_mops = MopsPerSec(keys.size(), start);
+
+            const std::size_t table_bytes = g_live_bytes.load() - before;
+
+            start = Clock::now();
+            for (std::uint32_t i : order)
+            {
+                hits += store.find(keys[i]) != store.end();
+            }
+            const double get_mops = MopsPerSec(order.size(), start);
+
+            std::printf("%-20s SET %6.2f Mops/s   GET %6.2f Mops/s   %6.1f bytes/key\n",
+                        name,
+                        set_mops,
+                        get_mops,
+                        static_cast<double>(table_bytes) / static_cast<double>(keys.size()));
+        }
+
+        if (hits != order.size())
+        {
+            std::printf("  lookup mismatch: %zu of %zu found\n", hits, order.size());
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        keys.push_back("key:" + std::to_string(i));
+    }
+
+    std::vector<std::uint32_t> order(count);
+    std::mt19937 rng(7);
+    for (auto &index : order)
+    {
+        index = static_cast<std::uint32_t>(rng() % count);
+    }
+
+    std::printf("%zu keys, sizeof(Entry) = %zu\n", count, sizeof(Entry));
+
+    Run<std::unordered_map<std::string, Entry>>("std::unordered_map", keys, order);
+    Run<kvmemo::core::FlatHashMap<std::string, Entry>>("core::FlatHashMap", keys, order);
+
+    return 0;
+}
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -0,0 +1,150 @@
+/**
+ * @file shard_read_bench.cpp
+ * @brief Compares Shard GET throughput with the shared lock and with
+ *        lock-free reads as reader threads are added.
+ *
+ * Usage : bench_shard_read [max_threads] [keys]   (default hw threads, 100,000)
+ *
+ * Every thread runs the same read-mostly mix on one shard: 95% GET and
+ * 5% SET of 16-byte values, keys drawn from a Zipf(0.99) distribution so
+ * a few hot records take most of the traffic. Thread counts double from
+ * 1 up to max_threads.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/shard.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using kvmemo::core::ReadMode;
+    using kvmemo::core::Shard;
+
+    constexpr std::size_t kOpsPerThread = 2'000'000;
+    constexpr std::size_t kSamples = 1 << 20;
+
+    /**
+     * @brief Key indices drawn from Zipf(0.99) over @p keys.
+     */
+    std::vector<std::uint32_t> ZipfSamples(std::size_t keys, std::uint32_t seed)
+    {
+        std::vector<double> cdf(keys);
+        double sum = 0;
+        for (std::size_t i = 0; i < keys; ++i)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), 0.99);
+            cdf[i] = sum;
+        }
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> uniform(0, sum);
+
+        std::vector<std::uint32_t> samples(kSamples);
+        for (auto &sample : samples)
+        {
+            sample = static_cast<std::uint32_t>(
+                std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        }
+        return samples;
+    }
+
+    double Run(ReadMode mode,
+               std::size_t threads,
+               const std::vector<std::string> &keys,
+               const std::vector<std::uint32_t> &samples)
+    {
+        Shard shard(keys.size(), mode);
+        const std::string value(16, 'v');
+
+        for (const auto &key : keys)
+        {
+            shard.Set(key, value);
+        }
+
+        std::atomic<bool> go{false};
+        std::vector<std::thread> workers;
+
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]
+                                 {
+                                     while (!go.load(std::memory_order_acquire))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+
+                                     std::size_t next = t * 7919;
+                                     for (std::size_t i = 0; i < kOpsPerThread; ++i)
+                                     {
+                                         const std::string &key = keys[samples[next++ & (kSamples - 1)]];
+                                         if (i % 20 == 0)
+                                         {
+                                             shard.Set(key, value);
+                                         }
+                                         else
+                                         {
+                                             shard.Get(key);
+                                         }
+                                     } });
+        }
+
+        const auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return static_cast<double>(threads * kOpsPerThread) / seconds / 1e6;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t max_threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : hw;
+    const std::size_t count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100'000;
+
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        keys.push_back("key:" + std::to_string(i));
+    }
+
+    const auto samples = ZipfSamples(count, 7);
+
+    std::printf("%zu keys, 95%% GET / 5%% SET, zipf 0.99, %zu hw threads\n", count, hw);
+    std::printf("%8s %18s %18s\n", "threads", "shared (Mops/s)", "lock-free (Mops/s)");
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        const double shared = Run(ReadMode::kShared, threads, keys, samples);
+        const double lock_free = Run(ReadMode::kLockFree, threads, keys, samples);
+
+        std::printf("%8zu %18.2f %18.2f\n", threads, shared, lock_free);
+    }
+
+    return 0;
+}
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -1,16 +1,48 @@
-import socket, time
+import socket, struct, time
 
 HOST, PORT = "127.0.0.1", 8082
 N = 10000
 
-def send_cmd(sock, cmd):
-    msg = cmd.encode()
-    sock.sendall(len(msg).to_bytes(4, 'big') + msg)
+def recv_exact(sock, n):
+    data = b""
+    while len(data) < n:
+        chunk = sock.recv(n - len(data))
+        if not chunk:
+            raise ConnectionError("server closed connection")
+        data += chunk
+    return data
+
+def negotiate_binary(sock):
+    sock.sendall(b"PROTOCOL BINARY\r\n")
+    reply = recv_exact(sock, 5)
+    if reply != b"+OK\r\n":
+        raise RuntimeError(f"binary protocol rejected: {reply!r}")
+
+def encode(*fields):
+    # [u32 body_len] [u32 field_count] { [u32 field_len] [bytes] }
+    body = struct.pack(">I", len(fields))
+    for field in fields:
+        body += struct.pack(">I", len(field)) + field
+    return struct.pack(">I", len(body)) + body
+
+def read_reply(sock):
+    # [u8 type] [u32 len] [payload]
+    kind, length = struct.unpack(">cI", recv_exact(sock, 5))
+    return kind, recv_exact(sock, length)
 
-start = time.perf_counter()
 s = socket.create_connection((HOST, PORT))
+negotiate_binary(s)
+
+start = time.perf_counter()
 for i in range(N):
-    send_cmd(s, f"SET key{i} value{i}")
+    s.sendall(encode(b"SET", f"key{i}".encode(), f"value {i}\r\n".encode()))
+for i in range(N):
+    kind, _ = read_reply(s)
+    assert kind == b"+", kind
 elapsed = (time.perf_counter() - start) * 1000
 print(f"Insert {N} memos: {elapsed:.1f}ms  ({N/elapsed*1000:.0f} ops/sec)")
-s.close()
\ No newline at end of file
+
+s.sendall(encode(b"GET", b"key42"))
+kind, value = read_reply(s)
+assert kind == b"$" and value == b"value 42\r\n", (kind, value)
+s.close()
@@ -0,0 +1,171 @@
+#pragma once
+/**
+ *  @file blob.h
+ *  @brief Reference-counted immutable byte buffer.
+ *
+ *  Responsibilities :
+ *  - Hold a value's bytes in one allocation that several owners share.
+ *  - Let a stored value be handed to the network layer without copying:
+ *    the store and every in-flight reply each hold a reference, and the
+ *    bytes are freed when the last one is dropped.
+ *
+ *  Design :
+ *  > A Blob of more than kInlineCapacity bytes points to a block laid out
+ *    as [ refcount | size ][ bytes ... ]. Copying a Blob bumps the
+ *    refcount; the bytes are never modified after Copy().
+ *  > Up to kInlineCapacity bytes are kept in the handle itself, so a GET
+ *    of a small value allocates nothing (as std::string's SSO did).
+ *
+ *  Thread Safety :
+ *  > Distinct Blob handles to the same bytes may be copied and destroyed
+ *    concurrently; one handle is not thread-safe.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <utility>
+
+namespace kvmemo::common {
+
+    class Blob final {
+        public:
+        /**
+         * @brief Largest size kept in the handle instead of a shared block.
+         */
+        static constexpr std::size_t kInlineCapacity = 23;
+
+        Blob() noexcept = default;
+
+        /**
+         * @brief Returns a blob holding a copy of @p bytes; allocates only
+         *        above kInlineCapacity.
+         */
+        static Blob Copy(std::string_view bytes) {
+            if(bytes.size() <= kInlineCapacity) {
+                Blob blob;
+                std::memcpy(blob.inline_, bytes.data(), bytes.size());
+                blob.inline_size_ = static_cast<std::uint8_t>(bytes.size());
+                return blob;
+            }
+
+            void* memory = ::operator new(sizeof(Block) + bytes.size());
+            Block* block = new (memory) Block(bytes.size());
+
+            if(!bytes.empty()) {
+                std::memcpy(reinterpret_cast<char*>(block + 1), bytes.data(), bytes.size());
+            }
+
+            return Blob(block);
+        }
+
+        Blob(const Blob& other) noexcept : block_(other.block_), inline_size_(other.inline_size_) {
+            std::memcpy(inline_, other.inline_, inline_size_);
+            if(block_ != nullptr) {
+                block_->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        Blob& operator=(const Blob& other) noexcept {
+            Blob(other).Swap(*this);
+            return *this;
+        }
+
+        Blob(Blob&& other) noexcept
+            : block_(std::exchange(other.block_, nullptr)),
+              inline_size_(std::exchange(other.inline_size_, 0)) {
+            std::memcpy(inline_, other.inline_, inline_size_);
+        }
+
+        Blob& operator=(Blob&& other) noexcept {
+            Blob(std::move(other)).Swap(*this);
+            return *this;
+        }
+
+        ~Blob() {
+            Reset();
+        }
+
+        /**
+         * @brief Drops this reference; frees the bytes if it was the last.
+         */
+        void Reset() noexcept {
+            inline_size_ = 0;
+            Block* block = std::exchange(block_, nullptr);
+
+            if(block != nullptr && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                block->~Block();
+                ::operator delete(block);
+            }
+        }
+
+        void Swap(Blob& other) noexcept {
+            std::swap(block_, other.block_);
+            std::swap(inline_, other.inline_);
+            std::swap(inline_size_, other.inline_size_);
+        }
+
+        std::string_view View() const noexcept {
+            return block_ == nullptr ? std::string_view(inline_, inline_size_)
+                                     : std::string_view(reinterpret_cast<const char*>(block_ + 1), block_->size);
+        }
+
+        const char* Data() const noexcept {
+            return View().data();
+        }
+
+        std::size_t Size() const noexcept {
+            return block_ == nullptr ? inline_size_ : block_->size;
+        }
+
+        bool Empty() const noexcept {
+            return Size() == 0;
+        }
+
+        /**
+         * @brief Heap bytes of the shared block (0 for an inline or empty
+         *        handle).
+         */
+        std::size_t AllocationSize() const noexcept {
+            return block_ == nullptr ? 0 : sizeof(Block) + block_->size;
+        }
+
+        /**
+         * @brief Current number of handles sharing the bytes; 1 for inline
+         *        bytes, which each handle owns.
+         */
+        std::size_t UseCount() const noexcept {
+            if(block_ == nullptr) {
+                return inline_size_ == 0 ? 0 : 1;
+            }
+            return block_->refs.load(std::memory_order_relaxed);
+        }
+
+        private:
+        struct Block {
+            explicit Block(std::size_t n) noexcept : size(n) {}
+
+            std::atomic<std::size_t> refs{1};
+            const std::size_t size;
+        };
+
+        explicit Blob(Block* block) noexcept : block_(block) {}
+
+        Block* block_{nullptr};
+        char inline_[kInlineCapacity]{};
+        std::uint8_t inline_size_{0};
+    };
+
+    static_assert(sizeof(Blob) == 32, "Blob handle should fill half a cache line");
+} // namespace kvmemo::common
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
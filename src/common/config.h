@@ -18,7 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "src/common/status.h"
+#include "status.h"
 
 namespace kvmemo::common {
 
@@ -28,11 +28,35 @@ namespace kvmemo::common {
  *
  * Notes:
  *  - We support LRU as the primary policy.
+ *  - kSampledLRU approximates LRU by sampling per-key access clocks, so
+ *    GET hits do not reorder any list (Redis's allkeys-lru).
+ *  - kTinyLFU (W-TinyLFU) weighs recency against an estimate of how often
+ *    each key was used, and refuses new keys colder than what they would
+ *    displace, so scans and one-hit keys do not flush hot ones.
+ *  - kLFU evicts the least frequently used key, with logarithmic counts
+ *    that decay while a key goes unused.
  *  - TTL is not an eviction policy; it is expiration logic.
  */
 enum class EvictionPolicy : std::uint8_t {
   kNone = 0,
   kLRU = 1,
+  kSampledLRU = 2,
+  kTinyLFU = 3,
+  kLFU = 4,
+};
+
+/**
+ * @enum IoBackend
+ * @brief Selects how event-loop threads perform socket I/O.
+ *
+ * Notes:
+ *  - kIoUring is only available when built with KVMEMO_ENABLE_IO_URING.
+ *    If it is unavailable at build or run time, the server falls back to
+ *    kEpoll.
+ */
+enum class IoBackend : std::uint8_t {
+  kEpoll = 0,
+  kIoUring = 1,
 };
 
 /**
@@ -54,13 +78,38 @@ struct Config final {
   /**
    * @brief Maximum memory allowed for the in-memory store (bytes).
    *
-   * This is the global limit across all shards.
-   * When exceeded, eviction is triggered based on the configured policy.
+   * This is the global limit across all shards. It is the hard limit:
+   * above it a write first evicts a batch itself and is refused if that
+   * frees nothing. Normally the background evictor keeps usage between the
+   * watermarks below so writes never reach it.
    *
    * Default: 256 MB (safe for laptops and dev machines).
    */
   std::uint64_t max_memory_bytes = 256ULL * 1024ULL * 1024ULL;
 
+  /**
+   * @brief Usage (percent of max_memory_bytes) above which the background
+   * evictor starts evicting.
+   *
+   * Default: 90.
+   */
+  std::uint32_t eviction_high_watermark_percent = 90;
+
+  /**
+   * @brief Usage (percent of max_memory_bytes) the background evictor
+   * brings memory back down to.
+   *
+   * Default: 80.
+   */
+  std::uint32_t eviction_low_watermark_percent = 80;
+
+  /**
+   * @brief Interval (in milliseconds) at which the evictor checks usage.
+   * Default: 5ms (writers would need to fill the gap between the high
+   * watermark and the hard limit within one interval to be throttled).
+   */
+  std::uint32_t eviction_interval_ms = 5;
+
   /**
    * @brief Maximum size of a single value stored in the KV store (bytes).
    *
@@ -86,11 +135,30 @@ struct Config final {
    */
   std::size_t max_connections = 4096;
 
+  /**
+   * @brief Per-connection limit on replies waiting to be sent (bytes).
+   *
+   * Once a client has this much unsent output the server stops reading
+   * and executing its requests until the backlog drains to half the limit,
+   * so a client that does not consume its replies cannot grow memory
+   * without bound or delay other clients.
+   *
+   * Default: 4 MB.
+   */
+  std::size_t max_output_buffer_bytes = 4ULL * 1024ULL * 1024ULL;
+
   /**
    * @brief Number of worker threads for handling client requests.
    */
   std::size_t worker_threads = 0;
 
+  /**
+   * @brief Socket I/O backend used by the event-loop threads.
+   *
+   * Default: epoll.
+   */
+  IoBackend io_backend = IoBackend::kEpoll;
+
   /**
    * @brief Enables TTL support.
    *
@@ -106,6 +174,18 @@ struct Config final {
    */
   std::uint32_t ttl_sweep_interval_ms = 250;
 
+  /**
+   * @brief Serves GETs without taking the shard lock.
+   *
+   * Readers probe an epoch-protected index instead of sharing the shard
+   * mutex with writers. Overwrites always allocate a new record and
+   * recency becomes approximate (CLOCK-style reference bits), in exchange
+   * for reads that scale across cores on hot shards.
+   *
+   * Default: false.
+   */
+  bool lock_free_reads = false;
+
   /**
    * @brief Enables metrics collection.
    *
@@ -127,6 +207,32 @@ struct Config final {
    */
   EvictionPolicy eviction_policy = EvictionPolicy::kLRU;
 
+  /**
+   * @brief Keys sampled per eviction by kSampledLRU.
+   *
+   * More samples track exact LRU more closely at a higher cost per
+   * eviction.
+   *
+   * Default: 5.
+   */
+  std::uint32_t eviction_samples = 5;
+
+  /**
+   * @brief How slowly kLFU access counts grow: a hit increments a count
+   *        with probability 1 / ((count - 5) * factor + 1). 0 counts
+   *        every hit.
+   *
+   * Default: 10 (a count of 255 takes about a million hits).
+   */
+  std::uint32_t lfu_log_factor = 10;
+
+  /**
+   * @brief Idle time that costs a kLFU key one count. 0 disables decay.
+   *
+   * Default: 60 seconds.
+   */
+  std::uint64_t lfu_decay_ms = 60'000;
+
   /**
    * @brief Validates the configuration.
    *
@@ -150,6 +256,17 @@ struct Config final {
       return Status::InvalidArgument("Config.max_memory_bytes must be > 0");
     }
 
+    if (eviction_low_watermark_percent == 0 ||
+        eviction_low_watermark_percent >= eviction_high_watermark_percent ||
+        eviction_high_watermark_percent > 100) {
+      return Status::InvalidArgument(
+          "Config eviction watermarks must satisfy 0 < low < high <= 100");
+    }
+
+    if (eviction_interval_ms == 0) {
+      return Status::InvalidArgument("Config.eviction_interval_ms must be > 0");
+    }
+
     if (max_value_bytes == 0) {
       return Status::InvalidArgument("Config.max_value_bytes must be > 0");
     }
@@ -167,6 +284,10 @@ struct Config final {
       return Status::InvalidArgument("Config.max_connections must be > 0");
     }
 
+    if (max_output_buffer_bytes == 0) {
+      return Status::InvalidArgument("Config.max_output_buffer_bytes must be > 0");
+    }
+
     // If worker_threads == 0, we treat it as auto-detect later.
     // But if explicitly set, it must be reasonable.
     if (worker_threads > 0 && worker_threads > 1024) {
@@ -181,15 +302,30 @@ struct Config final {
       }
     }
 
+    switch (io_backend) {
+      case IoBackend::kEpoll:
+      case IoBackend::kIoUring:
+        break;
+      default:
+        return Status::InvalidArgument("Config.io_backend is invalid");
+    }
+
     // Eviction policy validation.
     switch (eviction_policy) {
       case EvictionPolicy::kNone:
       case EvictionPolicy::kLRU:
+      case EvictionPolicy::kSampledLRU:
+      case EvictionPolicy::kTinyLFU:
+      case EvictionPolicy::kLFU:
         break;
       default:
         return Status::InvalidArgument("Config.eviction_policy is invalid");
     }
 
+    if (eviction_samples == 0) {
+      return Status::InvalidArgument("Config.eviction_samples must be > 0");
+    }
+
     return Status::Ok();
   }
 };
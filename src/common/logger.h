@@ -34,7 +34,7 @@
 #include <string>
 #include <thread>
 
-#include "src/common/time.h"
+#include "time.h"
 
 namespace kvmemo::common {
 
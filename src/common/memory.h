@@ -0,0 +1,103 @@
+#pragma once
+/**
+ *  @file memory.h
+ *  @brief Memory accounting helpers for KVMemo.
+ *
+ *  Responsibilities :
+ *  - Convert a requested allocation size into the bytes the allocator
+ *    actually takes for it (chunk header and size-class rounding).
+ *  - Describe a store's memory split into key bytes, value bytes and
+ *    overhead, so the limit and its breakdown add up to the same total.
+ *
+ *  Allocator model :
+ *  > glibc malloc (ptmalloc): every chunk carries an 8-byte header and is
+ *    rounded up to a multiple of 16 bytes, 32 bytes at least. Requests of
+ *    kMmapThreshold bytes or more are served by mmap and rounded up to
+ *    whole pages, with a 16-byte header.
+ *  > Other allocators use different size classes, but the same model keeps
+ *    the accounting within a few percent of their real usage.
+ *
+ *  Thread Safety :
+ *  > Stateless functions; MemoryUsage is a plain value type.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <cstddef>
+#include <string>
+
+namespace kvmemo::common {
+
+    /**
+     * @brief Bytes the allocator uses to satisfy a request of @p requested
+     *        bytes (0 for 0).
+     */
+    constexpr std::size_t AllocatedBytes(std::size_t requested) noexcept {
+        constexpr std::size_t kHeader = sizeof(std::size_t);
+        constexpr std::size_t kAlignment = 16;
+        constexpr std::size_t kMinChunk = 32;
+        constexpr std::size_t kMmapThreshold = 128 * 1024;
+        constexpr std::size_t kPageSize = 4096;
+
+        if(requested == 0) {
+            return 0;
+        }
+
+        if(requested >= kMmapThreshold) {
+            return (requested + 2 * kHeader + kPageSize - 1) & ~(kPageSize - 1);
+        }
+
+        const std::size_t chunk = (requested + kHeader + kAlignment - 1) & ~(kAlignment - 1);
+        return chunk < kMinChunk ? kMinChunk : chunk;
+    }
+
+    /**
+     * @brief Heap bytes behind @p text; 0 while it fits the string's
+     *        inline buffer.
+     */
+    inline std::size_t HeapBytes(const std::string& text) noexcept {
+        static const std::size_t kInlineCapacity = std::string().capacity();
+        return text.capacity() > kInlineCapacity ? AllocatedBytes(text.capacity() + 1) : 0;
+    }
+
+    /**
+     * @brief Memory held by stored data, split by what it is spent on.
+     *
+     *  Total() is what counts against Config::max_memory_bytes.
+     */
+    struct MemoryUsage {
+        // Bytes of stored keys.
+        std::size_t key_bytes{0};
+
+        // Bytes of stored values.
+        std::size_t value_bytes{0};
+
+        // Everything else: record headers, padding, unused value capacity,
+        // allocator rounding and index tables.
+        std::size_t overhead_bytes{0};
+
+        std::size_t Total() const noexcept {
+            return key_bytes + value_bytes + overhead_bytes;
+        }
+
+        MemoryUsage& operator+=(const MemoryUsage& other) noexcept {
+            key_bytes += other.key_bytes;
+            value_bytes += other.value_bytes;
+            overhead_bytes += other.overhead_bytes;
+            return *this;
+        }
+
+        MemoryUsage& operator-=(const MemoryUsage& other) noexcept {
+            key_bytes -= other.key_bytes;
+            value_bytes -= other.value_bytes;
+            overhead_bytes -= other.overhead_bytes;
+            return *this;
+        }
+    };
+} // namespace kvmemo::common
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -15,13 +15,20 @@
  *  - TTL expiration requires a wall-clock timestamp (epoch time).
  *  - Latency measurement must use a monotonic clock to avoid issues when system
  *    time changes (NTP adjustments, manual changes, daylight savings).
+ *  - Hot-path expiry checks use CoarseClock: epoch milliseconds that advance
+ *    with the monotonic clock (so an NTP step cannot expire or revive keys
+ *    en masse) and are read from a cached atomic while a Ticker runs.
  *
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */ 
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
+#include <thread>
 
 
 namespace kvmemo::common {
@@ -76,7 +83,102 @@ namespace kvmemo::common {
             const auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
             return static_cast<EpochMillis>(diff.count());
         }
-    };       
+    };
+
+    /**
+     * @class CoarseClock
+     * @brief Millisecond clock for TTL bookkeeping on the hot path.
+     *
+     *  Now() is the wall-clock time at process start plus the steady time
+     *  elapsed since, so it never jumps when the system clock is stepped.
+     *  While at least one Ticker is alive it is a single relaxed atomic
+     *  load of a value refreshed every millisecond; otherwise it is
+     *  computed on each call, so code without a ticker (tests, tools)
+     *  still sees exact time.
+     */
+    class CoarseClock final {
+        public:
+        CoarseClock() = delete;
+
+        [[nodiscard]] static EpochMillis Now() noexcept {
+            if(State().tickers.load(std::memory_order_relaxed) > 0) {
+                return State().cached.load(std::memory_order_relaxed);
+            }
+            return Compute();
+        }
+
+        /**
+         * @brief Keeps the cached time fresh from a background thread for
+         *        its lifetime.
+         */
+        class Ticker final {
+            public:
+            explicit Ticker(DurationMillis period = DurationMillis(1)) : period_(period) {
+                Refresh();
+                State().tickers.fetch_add(1, std::memory_order_relaxed);
+                thread_ = std::thread([this] { Loop(); });
+            }
+
+            Ticker(const Ticker&) = delete;
+            Ticker& operator=(const Ticker&) = delete;
+
+            Ticker(Ticker&&) = delete;
+            Ticker& operator=(Ticker&&) = delete;
+
+            ~Ticker() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                cv_.notify_one();
+                thread_.join();
+
+                State().tickers.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            private:
+            void Loop() {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while(!cv_.wait_for(lock, period_, [this] { return stop_; })) {
+                    Refresh();
+                }
+            }
+
+            const DurationMillis period_;
+            std::mutex mutex_;
+            std::condition_variable cv_;
+            bool stop_{false};
+            std::thread thread_;
+        };
+
+        private:
+        struct Shared {
+            const EpochMillis base_epoch{Clock::NowEpochMillis()};
+            const SteadyTimePoints base_steady{Clock::NowSteady()};
+
+            std::atomic<EpochMillis> cached{0};
+            std::atomic<int> tickers{0};
+        };
+
+        static Shared& State() noexcept {
+            static Shared state;
+            return state;
+        }
+
+        static EpochMillis Compute() noexcept {
+            const Shared& state = State();
+            return state.base_epoch + Clock::ElapsedMillis(state.base_steady, Clock::NowSteady());
+        }
+
+        // Never moves the cached value backwards when tickers race.
+        static void Refresh() noexcept {
+            const EpochMillis now = Compute();
+            EpochMillis seen = State().cached.load(std::memory_order_relaxed);
+            while(seen < now &&
+                  !State().cached.compare_exchange_weak(seen, now, std::memory_order_relaxed)) {
+            }
+        }
+    };
 
 } // namespace kvmemo::common
 
@@ -0,0 +1,120 @@
+#pragma once
+/**
+ * @file access_buffer.h
+ * @brief Lossy buffer of record accesses made under a shared lock.
+ *
+ * Responsibilities :
+ *    - Let concurrent readers note which record they touched without
+ *      modifying the recency list.
+ *    - Replay those accesses, oldest first, when the owner next holds
+ *      its exclusive lock.
+ *
+ * Design Principles :
+ *   > Fixed ring of Capacity slots. A reader claims a slot with one
+ *     fetch_add; once the ring is full further accesses are dropped
+ *     (recency is a hint, losing some touches only blurs the LRU order).
+ *   > A full ring is detected with a plain load, so readers of a hot
+ *     shard stop writing to the buffer until the next drain.
+ *   > Record() is called only under the owner's shared lock and Drain()
+ *     / Clear() only under its exclusive lock. The lock orders slot
+ *     stores before the drain, so relaxed atomics suffice.
+ *
+ *  Thread Safety :
+ *   => Record() is safe from concurrent readers.
+ *   => Drain() and Clear() require exclusive access.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace kvmemo::core
+{
+    template <typename T, std::size_t Capacity = 64>
+    class AccessBuffer final
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        AccessBuffer() = default;
+
+        AccessBuffer(const AccessBuffer &) = delete;
+        AccessBuffer &operator=(const AccessBuffer &) = delete;
+
+        AccessBuffer(AccessBuffer &&) = delete;
+        AccessBuffer &operator=(AccessBuffer &&) = delete;
+
+        ~AccessBuffer() = default;
+
+        /**
+         * @brief Notes an access to @p item.
+         * @return false if the buffer was full and the access was dropped.
+         */
+        bool Record(T *item) noexcept
+        {
+            if (write_.load(std::memory_order_relaxed) - read_ >= Capacity)
+            {
+                return false;
+            }
+
+            const std::uint64_t index = write_.fetch_add(1, std::memory_order_relaxed);
+            if (index - read_ >= Capacity)
+            {
+                return false;
+            }
+
+            slots_[index & (Capacity - 1)].store(item, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Calls @p fn on every buffered item in access order and
+         *        empties the buffer.
+         */
+        template <typename Fn>
+        void Drain(Fn &&fn) noexcept
+        {
+            const std::uint64_t write = write_.load(std::memory_order_relaxed);
+            const std::uint64_t pending = write - read_ < Capacity ? write - read_ : Capacity;
+
+            for (std::uint64_t i = 0; i < pending; ++i)
+            {
+                fn(slots_[(read_ + i) & (Capacity - 1)].load(std::memory_order_relaxed));
+            }
+
+            read_ = write;
+        }
+
+        /**
+         * @brief Drops every buffered item; use when the items themselves
+         *        are being destroyed.
+         */
+        void Clear() noexcept
+        {
+            read_ = write_.load(std::memory_order_relaxed);
+        }
+
+        bool Empty() const noexcept
+        {
+            return write_.load(std::memory_order_relaxed) == read_;
+        }
+
+    private:
+        std::array<std::atomic<T *>, Capacity> slots_{};
+
+        // Claimed by readers; kept off the line the drain index sits on.
+        alignas(64) std::atomic<std::uint64_t> write_{0};
+
+        // Advanced only under the owner's exclusive lock.
+        alignas(64) std::uint64_t read_{0};
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
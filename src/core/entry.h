@@ -44,11 +44,11 @@ namespace kvmemo::core {
          * @brief Contruct a non-expiring entry.
          */
         explicit Entry(std::string value) : value_(std::move(value)),
-                                        created_at_(common::Clock::NowEpochMillis()),
+                                        created_at_(common::CoarseClock::Now()),
                                         expire_at_(0) {}
 
         Entry(std::string value, std::uint64_t ttl_ms) : value_(std::move(value)),
-                                        created_at_(common::Clock::NowEpochMillis()),
+                                        created_at_(common::CoarseClock::Now()),
                                         expire_at_(ttl_ms == 0 ? 0 : created_at_ + ttl_ms) {}
 
         Entry() : value_(""), created_at_(0), expire_at_(0) {}
@@ -72,7 +72,7 @@ namespace kvmemo::core {
          */
         void Update(std::string new_value, std::uint64_t ttl_ms = 0) {
             value_ = std::move(new_value);
-            created_at_ = common::Clock::NowEpochMillis();
+            created_at_ = common::CoarseClock::Now();
             expire_at_ = ttl_ms == 0 ? 0 : created_at_ + ttl_ms;
         }
 
@@ -104,7 +104,7 @@ namespace kvmemo::core {
             if(expire_at_ == 0) {
                 return false;
             }
-            return common::Clock::NowEpochMillis() >= expire_at_;
+            return common::CoarseClock::Now() >= expire_at_;
         }
 
         /**
@@ -119,7 +119,7 @@ namespace kvmemo::core {
                 return 0;
             }
 
-            const auto now = common::Clock::NowEpochMillis();
+            const auto now = common::CoarseClock::Now();
             if(now >= expire_at_) {
                 return 0;
             }
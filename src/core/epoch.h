@@ -0,0 +1,306 @@
+#pragma once
+/**
+ * @file epoch.h
+ * @brief Epoch-based reclamation for memory read without locks.
+ *
+ * Responsibilities :
+ *    - Let reader threads mark the span in which they may hold pointers
+ *      to shared objects (EpochGuard).
+ *    - Defer freeing objects unlinked by writers (RetireList) until no
+ *      reader that could have seen them is still inside a guard.
+ *
+ * Design :
+ *   > A global epoch counter and one cache-line slot per registered
+ *     thread. A guard copies the global epoch into the thread's slot on
+ *     entry and clears it on exit.
+ *   > The epoch advances from e to e + 1 only once every pinned slot shows
+ *     e, so an object retired at epoch e is unreachable to all readers
+ *     once the epoch reaches e + 2.
+ *   > Threads claim a slot on first use and give it back when they exit.
+ *     Guards nest; only the outermost one touches the slot.
+ *
+ *  Thread Safety :
+ *   => EpochDomain and EpochGuard are thread-safe.
+ *   => RetireList is not; its owner serializes Retire() / Reclaim().
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace kvmemo::core
+{
+    /**
+     * @brief Process-wide epoch state shared by every lock-free reader.
+     */
+    class EpochDomain final
+    {
+    public:
+        using Epoch = std::uint64_t;
+
+        static constexpr std::size_t kMaxThreads = 256;
+
+        /**
+         * @brief The domain used by all shards.
+         */
+        static EpochDomain &Global() noexcept
+        {
+            static EpochDomain domain;
+            return domain;
+        }
+
+        EpochDomain(const EpochDomain &) = delete;
+        EpochDomain &operator=(const EpochDomain &) = delete;
+
+        EpochDomain(EpochDomain &&) = delete;
+        EpochDomain &operator=(EpochDomain &&) = delete;
+
+        Epoch Current() const noexcept
+        {
+            return epoch_.load(std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Advances the epoch if every pinned thread has observed the
+         *        current one.
+         * @return The epoch after the attempt.
+         */
+        Epoch TryAdvance() noexcept
+        {
+            Epoch current = epoch_.load(std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const std::size_t used = slots_used_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < used; ++i)
+            {
+                const Epoch pinned = slots_[i].epoch.load(std::memory_order_acquire);
+                if (pinned != kIdle && pinned != current)
+                {
+                    return current;
+                }
+            }
+
+            epoch_.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        friend class EpochGuard;
+
+        static constexpr Epoch kIdle = std::numeric_limits<Epoch>::max();
+
+        struct alignas(64) Slot
+        {
+            std::atomic<Epoch> epoch{kIdle};
+            std::atomic<bool> claimed{false};
+        };
+
+        /**
+         * @brief Per-thread registration; returns the slot when the thread
+         *        exits.
+         */
+        struct ThreadState
+        {
+            Slot *slot{nullptr};
+            std::size_t depth{0};
+
+            ~ThreadState()
+            {
+                if (slot != nullptr)
+                {
+                    slot->epoch.store(kIdle, std::memory_order_release);
+                    slot->claimed.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        EpochDomain() = default;
+
+        ThreadState &LocalState()
+        {
+            thread_local ThreadState state;
+
+            if (state.slot == nullptr)
+            {
+                state.slot = Claim();
+            }
+            return state;
+        }
+
+        Slot *Claim()
+        {
+            for (std::size_t i = 0; i < kMaxThreads; ++i)
+            {
+                bool expected = false;
+                if (slots_[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                {
+                    std::size_t used = slots_used_.load(std::memory_order_relaxed);
+                    while (used < i + 1 &&
+                           !slots_used_.compare_exchange_weak(used, i + 1, std::memory_order_acq_rel))
+                    {
+                    }
+                    return &slots_[i];
+                }
+            }
+
+            throw std::runtime_error("EpochDomain: too many reader threads");
+        }
+
+        std::atomic<Epoch> epoch_{0};
+        std::atomic<std::size_t> slots_used_{0};
+        std::array<Slot, kMaxThreads> slots_{};
+    };
+
+    /**
+     * @brief Pins the calling thread to the current epoch for its scope.
+     *
+     * Pointers loaded from lock-free structures stay valid until the
+     * guard is destroyed.
+     */
+    class EpochGuard final
+    {
+    public:
+        explicit EpochGuard(EpochDomain &domain = EpochDomain::Global())
+            : state_(domain.LocalState())
+        {
+            if (state_.depth++ == 0)
+            {
+                state_.slot->epoch.store(domain.Current(), std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        ~EpochGuard()
+        {
+            if (--state_.depth == 0)
+            {
+                state_.slot->epoch.store(EpochDomain::kIdle, std::memory_order_release);
+            }
+        }
+
+        EpochGuard(const EpochGuard &) = delete;
+        EpochGuard &operator=(const EpochGuard &) = delete;
+
+        EpochGuard(EpochGuard &&) = delete;
+        EpochGuard &operator=(EpochGuard &&) = delete;
+
+    private:
+        EpochDomain::ThreadState &state_;
+    };
+
+    /**
+     * @brief Objects unlinked by one writer, waiting for their grace period.
+     */
+    class RetireList final
+    {
+    public:
+        explicit RetireList(EpochDomain &domain = EpochDomain::Global()) noexcept
+            : domain_(domain) {}
+
+        RetireList(const RetireList &) = delete;
+        RetireList &operator=(const RetireList &) = delete;
+
+        RetireList(RetireList &&) = delete;
+        RetireList &operator=(RetireList &&) = delete;
+
+        /**
+         * @brief Frees everything; the owner guarantees no reader remains.
+         */
+        ~RetireList()
+        {
+            ReclaimAll();
+        }
+
+        /**
+         * @brief Schedules @p object for deletion by @p deleter once no
+         *        reader can still observe it. The object must already be
+         *        unreachable from the shared structure.
+         *
+         * @param bytes What freeing @p object returns to the allocator;
+         *        summed in Bytes() until then.
+         */
+        template <typename T, void (*Deleter)(T *)>
+        void Retire(T *object, std::size_t bytes = 0)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            items_.push_back({domain_.Current(), object, [](void *p)
+                              { Deleter(static_cast<T *>(p)); }, bytes});
+            bytes_ += bytes;
+        }
+
+        /**
+         * @brief Frees the objects whose grace period has elapsed.
+         * @return Number of objects freed.
+         */
+        std::size_t Reclaim() noexcept
+        {
+            if (items_.empty())
+            {
+                return 0;
+            }
+
+            const EpochDomain::Epoch epoch = domain_.TryAdvance();
+
+            // Items are appended in non-decreasing epoch order.
+            std::size_t freed = 0;
+            while (freed < items_.size() && items_[freed].epoch + 2 <= epoch)
+            {
+                items_[freed].free(items_[freed].object);
+                bytes_ -= items_[freed].bytes;
+                ++freed;
+            }
+
+            items_.erase(items_.begin(), items_.begin() + static_cast<std::ptrdiff_t>(freed));
+            return freed;
+        }
+
+        void ReclaimAll() noexcept
+        {
+            for (const auto &item : items_)
+            {
+                item.free(item.object);
+            }
+            items_.clear();
+            bytes_ = 0;
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return items_.size();
+        }
+
+        /**
+         * @brief Bytes of the objects still awaiting their grace period.
+         */
+        std::size_t Bytes() const noexcept
+        {
+            return bytes_;
+        }
+
+    private:
+        struct Item
+        {
+            EpochDomain::Epoch epoch;
+            void *object;
+            void (*free)(void *);
+            std::size_t bytes;
+        };
+
+        EpochDomain &domain_;
+        std::vector<Item> items_;
+        std::size_t bytes_{0};
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
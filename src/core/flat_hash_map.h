@@ -0,0 +1,711 @@
+#pragma once
+/**
+ * @file flat_hash_map.h
+ * @brief Open-addressing hash map with SIMD-probed control bytes
+ *        (Swiss table layout).
+ *
+ * Responsibilities :
+ *  - Store key/value pairs inline in one flat slot array, so a lookup
+ *    touches the control bytes and a single slot instead of chasing a
+ *    bucket list node per key.
+ *  - Probe 16 control bytes per step with SSE2 (portable loop otherwise).
+ *
+ * Layout :
+ *  > One control byte per slot: kEmpty, kDeleted, or the low 7 bits of
+ *    the key's hash (H2) when the slot is full. The first 15 bytes are
+ *    cloned past the end so any 16-byte group can be loaded unaligned.
+ *  > Probing walks groups in triangular steps from H1 (the rest of the
+ *    hash); slot keys are only compared when their H2 matches.
+ *  > Capacity is a power of two, filled to at most 7/8.
+ *
+ * Interface :
+ *  > Mirrors the std::unordered_map subset the shard uses (find, erase,
+ *    operator[], iteration with structured bindings). Keys must not be
+ *    modified through iterators. Any insertion may rehash and invalidate
+ *    iterators and references.
+ *
+ * Thread Safety :
+ *  > Not thread-safe; synchronization is handled by Shard.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../common/memory.h"
+
+namespace kvmemo::core
+{
+    template <typename Key,
+              typename Value,
+              typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>>
+    class FlatHashMap final
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Control bytes inspected per probe step.
+         */
+        static constexpr std::size_t kGroupWidth = 16;
+
+    private:
+        using Ctrl = std::int8_t;
+
+        static constexpr Ctrl kEmpty = -128;
+        static constexpr Ctrl kDeleted = -2;
+
+        static constexpr std::size_t kMinCapacity = kGroupWidth;
+
+        /**
+         * @brief Sixteen control bytes and the slot bitmasks derived from
+         *        them (bit i set = slot i of the group matches).
+         */
+        class Group
+        {
+        public:
+            explicit Group(const Ctrl *ctrl) noexcept
+            {
+#if defined(__SSE2__)
+                ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+                std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+            }
+
+            std::uint32_t Match(Ctrl h2) const noexcept
+            {
+#if defined(__SSE2__)
+                return static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+                return MaskWhere([h2](Ctrl c) { return c == h2; });
+#endif
+            }
+
+            std::uint32_t MatchEmpty() const noexcept
+            {
+                return Match(kEmpty);
+            }
+
+            /**
+             * @brief Empty and deleted are the only negative control bytes.
+             */
+            std::uint32_t MatchEmptyOrDeleted() const noexcept
+            {
+#if defined(__SSE2__)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+                return MaskWhere([](Ctrl c) { return c < 0; });
+#endif
+            }
+
+        private:
+#if defined(__SSE2__)
+            __m128i ctrl_;
+#else
+            template <typename Pred>
+            std::uint32_t MaskWhere(Pred pred) const noexcept
+            {
+                std::uint32_t mask = 0;
+                for (std::size_t i = 0; i < kGroupWidth; ++i)
+                {
+                    if (pred(ctrl_[i]))
+                    {
+                        mask |= 1u << i;
+                    }
+                }
+                return mask;
+            }
+
+            Ctrl ctrl_[kGroupWidth];
+#endif
+        };
+
+        template <bool IsConst>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FlatHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+            using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+
+            Iterator() = default;
+
+            /**
+             * @brief Non-const to const conversion.
+             */
+            template <bool C = IsConst, typename = std::enable_if_t<C>>
+            Iterator(const Iterator<false> &other) noexcept
+                : map_(other.map_), index_(other.index_) {}
+
+            reference operator*() const noexcept
+            {
+                return map_->slots_[index_];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &map_->slots_[index_];
+            }
+
+            Iterator &operator++() noexcept
+            {
+                index_ = map_->NextFull(index_ + 1);
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            friend bool operator==(const Iterator &a, const Iterator &b) noexcept
+            {
+                return a.index_ == b.index_;
+            }
+
+            friend bool operator!=(const Iterator &a, const Iterator &b) noexcept
+            {
+                return !(a == b);
+            }
+
+        private:
+            friend class FlatHashMap;
+            template <bool>
+            friend class Iterator;
+
+            using MapPtr = std::conditional_t<IsConst, const FlatHashMap *, FlatHashMap *>;
+
+            Iterator(MapPtr map, std::size_t index) noexcept : map_(map), index_(index) {}
+
+            MapPtr map_{nullptr};
+            std::size_t index_{0};
+        };
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatHashMap() = default;
+
+        FlatHashMap(const FlatHashMap &) = delete;
+        FlatHashMap &operator=(const FlatHashMap &) = delete;
+
+        FlatHashMap(FlatHashMap &&other) noexcept
+        {
+            Swap(other);
+        }
+
+        FlatHashMap &operator=(FlatHashMap &&other) noexcept
+        {
+            if (this != &other)
+            {
+                FlatHashMap tmp(std::move(other));
+                Swap(tmp);
+            }
+            return *this;
+        }
+
+        ~FlatHashMap()
+        {
+            DestroyAll();
+            Deallocate(ctrl_, slots_, capacity_);
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(this, NextFull(0));
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, capacity_);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this, NextFull(0));
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this, capacity_);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /**
+         * @brief Number of slots currently allocated.
+         */
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /**
+         * @brief Heap bytes of the control and slot arrays, as allocated.
+         */
+        std::size_t allocated_bytes() const noexcept
+        {
+            if (capacity_ == 0)
+            {
+                return 0;
+            }
+
+            return common::AllocatedBytes(capacity_ + kGroupWidth - 1) +
+                   common::AllocatedBytes(capacity_ * sizeof(value_type));
+        }
+
+        /**
+         * @brief The first entry stored at or after slot @p slot (end() if
+         *        none). Entries sit at hash-determined slots, so the run
+         *        after a random @p slot is a near-uniform sample of keys.
+         */
+        const_iterator from_slot(std::size_t slot) const noexcept
+        {
+            return const_iterator(this, NextFull(slot < capacity_ ? slot : capacity_));
+        }
+
+        iterator find(const Key &key)
+        {
+            return iterator(this, FindIndex(key, HashOf(key)));
+        }
+
+        const_iterator find(const Key &key) const
+        {
+            return const_iterator(this, FindIndex(key, HashOf(key)));
+        }
+
+        /**
+         * @brief Hash used for @p key; lets callers that cache it skip
+         *        rehashing the key on later lookups.
+         */
+        static std::size_t hash_of(const Key &key)
+        {
+            return HashOf(key);
+        }
+
+        iterator find(const Key &key, std::size_t hash)
+        {
+            return iterator(this, FindIndex(key, hash));
+        }
+
+        std::size_t count(const Key &key) const
+        {
+            return FindIndex(key, HashOf(key)) == capacity_ ? 0 : 1;
+        }
+
+        /**
+         * @brief Inserts a value constructed from @p args unless @p key is
+         *        present.
+         *
+         * @return Iterator to the element and whether it was inserted.
+         */
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args)
+        {
+            return Emplace(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args)
+        {
+            return Emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename V>
+        std::pair<iterator, bool> insert_or_assign(const Key &key, V &&value)
+        {
+            return Assign(key, std::forward<V>(value));
+        }
+
+        template <typename V>
+        std::pair<iterator, bool> insert_or_assign(Key &&key, V &&value)
+        {
+            return Assign(std::move(key), std::forward<V>(value));
+        }
+
+        Value &operator[](const Key &key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        Value &operator[](Key &&key)
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        std::size_t erase(const Key &key)
+        {
+            const std::size_t index = FindIndex(key, HashOf(key));
+
+            if (index == capacity_)
+            {
+                return 0;
+            }
+
+            EraseAt(index);
+            return 1;
+        }
+
+        /**
+         * @brief Erases the element at @p pos.
+         *
+         * @return Iterator to the next element.
+         */
+        iterator erase(const_iterator pos)
+        {
+            EraseAt(pos.index_);
+            return iterator(this, NextFull(pos.index_ + 1));
+        }
+
+        /**
+         * @brief Destroys every element; the slot array is kept.
+         */
+        void clear() noexcept
+        {
+            DestroyAll();
+
+            if (capacity_ != 0)
+            {
+                std::memset(ctrl_, kEmpty, capacity_ + kGroupWidth - 1);
+            }
+
+            size_ = 0;
+            growth_left_ = MaxLoad(capacity_);
+        }
+
+        /**
+         * @brief Allocates room for @p n elements without further rehashing.
+         */
+        void reserve(std::size_t n)
+        {
+            std::size_t capacity = kMinCapacity;
+            while (MaxLoad(capacity) < n)
+            {
+                capacity *= 2;
+            }
+
+            if (capacity > capacity_)
+            {
+                Rehash(capacity);
+            }
+        }
+
+    private:
+        Ctrl *ctrl_{nullptr};
+        value_type *slots_{nullptr};
+        std::size_t capacity_{0};
+        std::size_t size_{0};
+        std::size_t growth_left_{0};
+
+        template <typename K, typename... Args>
+        std::pair<iterator, bool> Emplace(K &&key, Args &&...args)
+        {
+            const std::size_t hash = HashOf(key);
+            const std::size_t found = FindIndex(key, hash);
+
+            if (found != capacity_)
+            {
+                return {iterator(this, found), false};
+            }
+
+            const std::size_t index = PrepareInsert(hash);
+
+            new (&slots_[index]) value_type(std::piecewise_construct,
+                                            std::forward_as_tuple(std::forward<K>(key)),
+                                            std::forward_as_tuple(std::forward<Args>(args)...));
+            SetCtrl(index, H2(hash));
+            ++size_;
+
+            return {iterator(this, index), true};
+        }
+
+        template <typename K, typename V>
+        std::pair<iterator, bool> Assign(K &&key, V &&value)
+        {
+            const std::size_t hash = HashOf(key);
+            const std::size_t found = FindIndex(key, hash);
+
+            if (found != capacity_)
+            {
+                slots_[found].second = std::forward<V>(value);
+                return {iterator(this, found), false};
+            }
+
+            return Emplace(std::forward<K>(key), std::forward<V>(value));
+        }
+
+        static std::size_t MaxLoad(std::size_t capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        /**
+         * @brief Hash with the bits spread so both H1 and H2 are usable even
+         *        for weak (e.g. identity) hashers.
+         */
+        static std::size_t HashOf(const Key &key)
+        {
+            const std::uint64_t h = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        static Ctrl H2(std::size_t hash) noexcept
+        {
+            return static_cast<Ctrl>(hash & 0x7F);
+        }
+
+        static std::size_t H1(std::size_t hash) noexcept
+        {
+            return hash >> 7;
+        }
+
+        static int TrailingZeros(std::uint32_t mask) noexcept
+        {
+            return __builtin_ctz(mask);
+        }
+
+        void SetCtrl(std::size_t index, Ctrl value) noexcept
+        {
+            ctrl_[index] = value;
+
+            if (index < kGroupWidth - 1)
+            {
+                ctrl_[capacity_ + index] = value;
+            }
+        }
+
+        std::size_t FindIndex(const Key &key, std::size_t hash) const
+        {
+            if (capacity_ == 0)
+            {
+                return capacity_;
+            }
+
+            const std::size_t mask = capacity_ - 1;
+            const Ctrl h2 = H2(hash);
+
+            std::size_t pos = H1(hash) & mask;
+            std::size_t step = 0;
+
+            while (true)
+            {
+                const Group group(ctrl_ + pos);
+
+                for (std::uint32_t match = group.Match(h2); match != 0; match &= match - 1)
+                {
+                    const std::size_t index = (pos + TrailingZeros(match)) & mask;
+
+                    if (KeyEqual{}(slots_[index].first, key))
+                    {
+                        return index;
+                    }
+                }
+
+                if (group.MatchEmpty() != 0)
+                {
+                    return capacity_;
+                }
+
+                step += kGroupWidth;
+                pos = (pos + step) & mask;
+            }
+        }
+
+        std::size_t FindInsertSlot(std::size_t hash) const noexcept
+        {
+            const std::size_t mask = capacity_ - 1;
+
+            std::size_t pos = H1(hash) & mask;
+            std::size_t step = 0;
+
+            while (true)
+            {
+                const std::uint32_t available = Group(ctrl_ + pos).MatchEmptyOrDeleted();
+
+                if (available != 0)
+                {
+                    return (pos + TrailingZeros(available)) & mask;
+                }
+
+                step += kGroupWidth;
+                pos = (pos + step) & mask;
+            }
+        }
+
+        /**
+         * @brief Returns a free slot for @p hash, growing (or purging
+         *        tombstones) first if the load limit has been reached.
+         */
+        std::size_t PrepareInsert(std::size_t hash)
+        {
+            if (growth_left_ == 0)
+            {
+                if (capacity_ == 0)
+                {
+                    Rehash(kMinCapacity);
+                }
+                else if (size_ <= MaxLoad(capacity_) / 2)
+                {
+                    // Mostly tombstones: rebuild in place.
+                    Rehash(capacity_);
+                }
+                else
+                {
+                    Rehash(capacity_ * 2);
+                }
+            }
+
+            const std::size_t index = FindInsertSlot(hash);
+
+            if (ctrl_[index] == kEmpty)
+            {
+                --growth_left_;
+            }
+
+            return index;
+        }
+
+        void EraseAt(std::size_t index)
+        {
+            slots_[index].~value_type();
+            --size_;
+
+            // A slot can go back to empty if no probe sequence ever saw a
+            // full 16-slot window around it; otherwise lookups that passed
+            // over it must keep probing, so it becomes a tombstone.
+            const std::size_t before = (index - kGroupWidth) & (capacity_ - 1);
+            const std::uint32_t empty_before = Group(ctrl_ + before).MatchEmpty();
+            const std::uint32_t empty_after = Group(ctrl_ + index).MatchEmpty();
+
+            const bool was_never_full =
+                empty_before != 0 && empty_after != 0 &&
+                static_cast<std::size_t>(__builtin_clz(empty_before) - 16 + TrailingZeros(empty_after)) < kGroupWidth;
+
+            if (was_never_full)
+            {
+                SetCtrl(index, kEmpty);
+                ++growth_left_;
+            }
+            else
+            {
+                SetCtrl(index, kDeleted);
+            }
+        }
+
+        std::size_t NextFull(std::size_t index) const noexcept
+        {
+            while (index < capacity_ && ctrl_[index] < 0)
+            {
+                ++index;
+            }
+            return index;
+        }
+
+        void Rehash(std::size_t new_capacity)
+        {
+            Ctrl *old_ctrl = ctrl_;
+            value_type *old_slots = slots_;
+            const std::size_t old_capacity = capacity_;
+
+            Allocate(new_capacity);
+
+            for (std::size_t i = 0; i < old_capacity; ++i)
+            {
+                if (old_ctrl[i] < 0)
+                {
+                    continue;
+                }
+
+                const std::size_t hash = HashOf(old_slots[i].first);
+                const std::size_t index = FindInsertSlot(hash);
+
+                new (&slots_[index]) value_type(std::move(old_slots[i]));
+                old_slots[i].~value_type();
+                SetCtrl(index, H2(hash));
+            }
+
+            growth_left_ = MaxLoad(capacity_) - size_;
+
+            Deallocate(old_ctrl, old_slots, old_capacity);
+        }
+
+        void Allocate(std::size_t capacity)
+        {
+            std::unique_ptr<Ctrl[]> ctrl(new Ctrl[capacity + kGroupWidth - 1]);
+            std::memset(ctrl.get(), kEmpty, capacity + kGroupWidth - 1);
+
+            slots_ = std::allocator<value_type>().allocate(capacity);
+            ctrl_ = ctrl.release();
+            capacity_ = capacity;
+        }
+
+        static void Deallocate(Ctrl *ctrl, value_type *slots, std::size_t capacity) noexcept
+        {
+            if (capacity == 0)
+            {
+                return;
+            }
+
+            std::allocator<value_type>().deallocate(slots, capacity);
+            delete[] ctrl;
+        }
+
+        void DestroyAll() noexcept
+        {
+            for (std::size_t i = 0; i < capacity_; ++i)
+            {
+                if (ctrl_[i] >= 0)
+                {
+                    slots_[i].~value_type();
+                }
+            }
+        }
+
+        void Swap(FlatHashMap &other) noexcept
+        {
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+            std::swap(growth_left_, other.growth_left_);
+        }
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -0,0 +1,149 @@
+#pragma once
+/**
+ * @file intrusive_lru.h
+ * @brief Recency list whose links live inside the tracked records.
+ *
+ * Responsibilities :
+ *    - Keep records in recency order in O(1) per operation.
+ *    - Hand out the least recently used record for eviction.
+ *
+ * Design Principles :
+ *   > Records derive from LRUHook, so linking a record allocates nothing
+ *     and the list never stores (or hashes) a copy of the key.
+ *   > The list does not own its records; the owner must Remove() a
+ *     record before destroying it.
+ *   > No internal synchronization (handled by shard).
+ *
+ *  Thread Safety :
+ *   => Not thread-safe
+ *   => Caller must ensure synchronization.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <cstddef>
+
+namespace kvmemo::core
+{
+    /**
+     * @brief Links embedded in every record tracked by IntrusiveLRU.
+     */
+    struct LRUHook
+    {
+        LRUHook *lru_prev{nullptr};
+        LRUHook *lru_next{nullptr};
+    };
+
+    /**
+     * @brief Doubly linked recency list over records of type T.
+     *
+     *  Most recently used record  -> Front
+     *  Least recently used record -> Back
+     */
+    template <typename T>
+    class IntrusiveLRU final
+    {
+    public:
+        IntrusiveLRU() noexcept
+        {
+            head_.lru_prev = &head_;
+            head_.lru_next = &head_;
+        }
+
+        // The sentinel's address is stored in the first and last records.
+        IntrusiveLRU(const IntrusiveLRU &) = delete;
+        IntrusiveLRU &operator=(const IntrusiveLRU &) = delete;
+
+        IntrusiveLRU(IntrusiveLRU &&) = delete;
+        IntrusiveLRU &operator=(IntrusiveLRU &&) = delete;
+
+        ~IntrusiveLRU() = default;
+
+        /**
+         * @brief Links a new record as most recently used.
+         */
+        void PushFront(T *record) noexcept
+        {
+            LinkAfter(&head_, record);
+            ++size_;
+        }
+
+        /**
+         * @brief Marks a linked record as most recently used.
+         */
+        void MoveToFront(T *record) noexcept
+        {
+            if (head_.lru_next == record)
+            {
+                return;
+            }
+
+            Unlink(record);
+            LinkAfter(&head_, record);
+        }
+
+        /**
+         * @brief Unlinks a record.
+         */
+        void Remove(T *record) noexcept
+        {
+            Unlink(record);
+            record->lru_prev = nullptr;
+            record->lru_next = nullptr;
+            --size_;
+        }
+
+        /**
+         * @brief Returns the least recently used record, or nullptr.
+         */
+        T *Back() const noexcept
+        {
+            return size_ == 0 ? nullptr : static_cast<T *>(head_.lru_prev);
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return size_;
+        }
+
+        bool Empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /**
+         * @brief Forgets every record without touching them; use when the
+         *        records themselves are being destroyed.
+         */
+        void Clear() noexcept
+        {
+            head_.lru_prev = &head_;
+            head_.lru_next = &head_;
+            size_ = 0;
+        }
+
+    private:
+        static void Unlink(LRUHook *node) noexcept
+        {
+            node->lru_prev->lru_next = node->lru_next;
+            node->lru_next->lru_prev = node->lru_prev;
+        }
+
+        static void LinkAfter(LRUHook *pos, LRUHook *node) noexcept
+        {
+            node->lru_prev = pos;
+            node->lru_next = pos->lru_next;
+            pos->lru_next->lru_prev = node;
+            pos->lru_next = node;
+        }
+
+        LRUHook head_;
+        std::size_t size_{0};
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -11,88 +11,158 @@
  * 
  *  Thread Safety
  *  > Thread-Safe
- *  > Delegates synchronization to shard layer.
+ *  > Delegates synchronization to shard layer. Eviction state is
+ *    partitioned by shard as well, so no engine operation takes a
+ *    process-wide lock.
+ *  > When the policy tracks accesses, a write or delete holds its shard's
+ *    policy partition lock across the store change and the policy hook,
+ *    so concurrent SETs and DELs of a key reach the policy in store
+ *    order. Keys removed by expiry are dropped from the policy under the
+ *    same lock, and only if the store has not been given the key again.
+ *
+ *  Expiry and recency are tracked by the shards on the records they
+ *  store; the engine keeps no per-key state of its own.
+ *
+ *  Memory :
+ *  > The shards charge their records to the EvictionManager's tracker.
+ *    Eviction down to the low watermark normally runs on the background
+ *    Evictor (see evictor.h); a write only evicts, and is refused if that
+ *    frees nothing, when usage is above the hard limit.
  * 
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "../common/blob.h"
+#include "../common/memory.h"
 #include "../common/time.h"
 #include "shard_manager.h"
-#include "ttl_index.h"
 #include "../eviction/eviction_manager.h"
 
 namespace kvmemo::core {
+    /**
+     * @brief Outcome of KVEngine::Set().
+     */
+    enum class SetResult : std::uint8_t {
+        kStored = 0,      // the key now holds the value
+        kOutOfMemory = 1, // over the hard limit and nothing could be evicted
+        kNotAdmitted = 2, // the policy refused a key colder than its victim
+    };
+
     class KVEngine {
         public: 
         /**
          * @brief Constructs KVEngine with required dependencies.
          */
         KVEngine(std::unique_ptr<ShardManager> shard_manager, 
-                 std::unique_ptr<TTLIndex> ttl_index, 
                  std::unique_ptr<eviction::EvictionManager> eviction_manager)
                 : shard_manager_(std::move(shard_manager)),
-                ttl_index_(std::move(ttl_index)),
-                eviction_manager_(std::move(eviction_manager)) {}
+                eviction_manager_(std::move(eviction_manager)) {
+            shard_manager_->TrackMemory(&eviction_manager_->Memory());
+        }
 
         KVEngine(const KVEngine&) = delete;
         KVEngine& operator=(const KVEngine&) = delete;
-        KVEngine(KVEngine&&) noexcept = default;
-        KVEngine& operator=(KVEngine&&) noexcept = default;
+        KVEngine(KVEngine&&) = delete;
+        KVEngine& operator=(KVEngine&&) = delete;
         ~KVEngine() = default;
 
+        /**
+         * @brief Keys evicted per batch, by the Evictor and by a write over
+         *        the hard limit.
+         */
+        static constexpr std::size_t kEvictionBatch = 64;
+
         /**
          * @brief Stores a key-value pair
          * 
          *  @param key   Key String
          *  @param value Value String 
          *  @param ttl_ms Optional TTL in milliseconds
+         *  @return kOutOfMemory if memory is over the hard limit and nothing
+         *          could be evicted; kNotAdmitted if, above the high
+         *          watermark, the policy refused a new key colder than what
+         *          eviction would drop for it. Either way the key is left
+         *          unchanged.
          */ 
-        void Set(const std::string& key,
-        const std::string& value, std::optional<uint64_t> ttl_ms = std::nullopt){
+        SetResult Set(std::string_view key,
+        std::string_view value, std::optional<uint64_t> ttl_ms = std::nullopt){
 
-            if(ttl_ms.has_value()) {
-                shard_manager_->SetWithTTL(key, value, ttl_ms.value());
+            if(eviction_manager_->IsOverHardLimit()) {
+                Evict(kEvictionBatch);
 
-                std::uint64_t expire_at = 
-                    common::Clock::NowEpochMillis() + ttl_ms.value();
+                if(eviction_manager_->IsOverHardLimit()) {
+                    return SetResult::kOutOfMemory;
+                }
+            }
 
-                ttl_index_->Upsert(key, expire_at);
+            if(!eviction_manager_->TracksAccesses()) {
+                Store(key, value, ttl_ms);
+                return SetResult::kStored;
             }
-            else {
-                shard_manager_->Set(key, std::move(value));
-                ttl_index_->Remove(key);
+
+            // The policy is asked and told under its partition lock, which
+            // is taken before (never under) the shard lock.
+            const std::size_t shard = shard_manager_->ShardIndex(key);
+            const auto lock = eviction_manager_->Lock(shard);
+            if(eviction_manager_->NeedsEviction() && !eviction_manager_->Admit(lock, shard, key)) {
+                return SetResult::kNotAdmitted;
             }
 
-            eviction_manager_->OnWrite(key);
+            Store(key, value, ttl_ms);
+            eviction_manager_->OnWrite(lock, shard, key);
+            return SetResult::kStored;
         }
 
         /**
          * @brief Retrives value for key.
          */
-        std::optional<std::string> Get(const std::string& key) {
+        std::optional<std::string> Get(std::string_view key) {
 
-            auto value = shard_manager_->Get(key);
-            if(value.has_value()) {
-                eviction_manager_->OnRead(key);
-            } 
+            bool expired = false;
+            auto value = shard_manager_->Get(key, &expired);
+            NoteRead(key, value.has_value(), expired);
+            return value;
+        }
 
-        
+        /**
+         * @brief Retrives value for key as a Blob; large values are shared
+         *        with the store instead of copied.
+         */
+        std::optional<common::Blob> GetShared(std::string_view key) {
+            bool expired = false;
+            auto value = shard_manager_->GetShared(key, &expired);
+            NoteRead(key, value.has_value(), expired);
             return value;
         }
 
         /**
-         * @brief Deletes a key.
+         * @brief Deletes a key. The policy is told only if a record was
+         *        removed, live or expired.
+         *
+         * @return true if a live key was removed.
          */
-        void Delete(const std::string& key) {
-            shard_manager_->Delete(key);
-            ttl_index_->Remove(key);
-            eviction_manager_->OnDelete(key);
+        bool Delete(std::string_view key) {
+            if(!eviction_manager_->TracksAccesses()) {
+                return shard_manager_->Delete(key);
+            }
+
+            const std::size_t shard = shard_manager_->ShardIndex(key);
+            const auto lock = eviction_manager_->Lock(shard);
+            bool expired = false;
+            const bool removed = shard_manager_->Delete(key, &expired);
+            if(removed || expired) {
+                eviction_manager_->OnDelete(lock, shard, key);
+            }
+            return removed;
         }
 
         /**
@@ -105,26 +175,111 @@ namespace kvmemo::core {
         }
 
         /**
-         * @brief Expires keys that are due.
-         * Called by TTL manager thread.
+         * @brief Expires every key that is due, in one pass.
          */
         void ProcessExpired() {
-            std::uint64_t now = common::Clock::NowEpochMillis();
-            auto expired_keys = ttl_index_->CollectExpired(now);
+            const std::uint64_t now = common::CoarseClock::Now();
+            for(std::size_t i = 0; i < shard_manager_->ShardCount(); ++i) {
+                ExpireShard(i, now, std::numeric_limits<std::size_t>::max());
+            }
+        }
 
-            for(const auto& key : expired_keys) {
-                shard_manager_->Delete(key);
-                eviction_manager_->OnDelete(key);
+        /**
+         * @brief Expires at most @p limit due keys of shard @p index.
+         * Called by TTL manager thread, one bounded batch at a time.
+         *
+         * @return Number of keys expired.
+         */
+        std::size_t ExpireShard(std::size_t index, std::uint64_t now, std::size_t limit) {
+            if(!eviction_manager_->TracksAccesses()) {
+                return shard_manager_->CleanupExpired(index, now, limit);
             }
+
+            // The policy is told after the shard lock is released.
+            std::vector<std::string> expired;
+            const std::size_t count = shard_manager_->CleanupExpired(index, now, limit, &expired);
+            if(!expired.empty()) {
+                const auto lock = eviction_manager_->Lock(index);
+                for(const auto& key : expired) {
+                    ForgetExpired(lock, index, key);
+                }
+            }
+            return count;
         }
 
-        void ProcessEvictions() {
-            auto victims = eviction_manager_->CollectEvictionCandidates();
+        /**
+         * @brief Frees records and index tables retired by lock-free
+         *        shards once no reader can see them. Called by the
+         *        background threads each cycle.
+         */
+        void ReclaimRetired() {
+            shard_manager_->ReclaimRetired();
+        }
+
+        /**
+         * @brief Memory held by stored data: key bytes, value bytes and
+         *        overhead, including the eviction policy's per-key state.
+         *        Its Total() is what the memory limit is checked against.
+         */
+        common::MemoryUsage MemoryUsage() const {
+            common::MemoryUsage usage = shard_manager_->MemoryUsage();
+            usage.overhead_bytes += eviction_manager_->PolicyMemoryUsage();
+            return usage;
+        }
+
+        /**
+         * @brief Memory breakdown of shard @p index.
+         */
+        common::MemoryUsage ShardMemoryUsage(std::size_t index) const {
+            return shard_manager_->MemoryUsage(index);
+        }
+
+        /**
+         * @brief Number of shards ExpireShard() accepts.
+         */
+        std::size_t ShardCount() const noexcept {
+            return shard_manager_->ShardCount();
+        }
 
-            for(const auto& key : victims) {
-                shard_manager_->Delete(key);
-                ttl_index_->Remove(key);
+        /**
+         * @brief Returns true once memory is above the high watermark.
+         */
+        bool NeedsEviction() const noexcept {
+            return eviction_manager_->NeedsEviction();
+        }
+
+        /**
+         * @brief Evicts at most @p limit keys chosen by the eviction policy,
+         *        stopping once memory is back under the low watermark.
+         *
+         *  A victim that had already expired or gone is removed (with its
+         *  policy state) but not counted, and does not use up @p limit.
+         *
+         * @return Number of live keys evicted.
+         */
+        std::size_t Evict(std::size_t limit) {
+            std::size_t evicted = 0;
+
+            while(evicted < limit) {
+                auto victim = eviction_manager_->NextEvictionCandidate(*shard_manager_);
+                if(!victim.has_value()) {
+                    break;
+                }
+
+                if(DeleteVictim(victim.value())) {
+                    ++evicted;
+                }
             }
+
+            return evicted;
+        }
+
+        /**
+         * @brief Evicts keys chosen by the eviction policy until memory is
+         *        back under the low watermark.
+         */
+        void ProcessEvictions() {
+            Evict(std::numeric_limits<std::size_t>::max());
         }
 
         /**
@@ -137,17 +292,68 @@ namespace kvmemo::core {
         }
 
         /**
-         * @brief Deletes all keys. Resets TTL index and memory tracker.
+         * @brief Deletes all keys. Resets eviction state and memory tracker.
          */
         void Flush() {
-            shard_manager_->Clear();
-            ttl_index_->Clear();
-            eviction_manager_->Clear();
+            eviction_manager_->Clear([this] { shard_manager_->Clear(); });
         }
 
     private:
+        /**
+         * @brief Reports a lookup to the policy: a hit as a read, a key
+         *        removed by lazy expiry as a delete.
+         */
+        void NoteRead(std::string_view key, bool hit, bool expired) {
+            if(!eviction_manager_->TracksAccesses() || (!hit && !expired)) {
+                return;
+            }
+
+            const std::size_t shard = shard_manager_->ShardIndex(key);
+            if(hit) {
+                eviction_manager_->OnRead(shard, key);
+            }
+            else {
+                ForgetExpired(eviction_manager_->Lock(shard), shard, key);
+            }
+        }
+
+        /**
+         * @brief Deletes a victim the policy named. Unlike Delete(), always
+         *        drops it from the policy, even if the store no longer held
+         *        it; otherwise the policy would name it again forever.
+         *
+         * @return true if a live key was removed.
+         */
+        bool DeleteVictim(std::string_view key) {
+            const std::size_t shard = shard_manager_->ShardIndex(key);
+            const auto lock = eviction_manager_->Lock(shard);
+            const bool removed = shard_manager_->Delete(key);
+            eviction_manager_->OnDelete(lock, shard, key);
+            return removed;
+        }
+
+        /**
+         * @brief Drops @p key, which expiry removed from shard @p shard,
+         *        from the policy unless a write has stored it again since;
+         *        @p lock orders this against that write.
+         */
+        void ForgetExpired(const eviction::EvictionManager::PartitionLock& lock,
+                           std::size_t shard, std::string_view key) {
+            if(!shard_manager_->Contains(key)) {
+                eviction_manager_->OnDelete(lock, shard, key);
+            }
+        }
+
+        void Store(std::string_view key, std::string_view value, std::optional<uint64_t> ttl_ms) {
+            if(ttl_ms.has_value()) {
+                shard_manager_->SetWithTTL(key, value, ttl_ms.value());
+            }
+            else {
+                shard_manager_->Set(key, value);
+            }
+        }
+
         std::unique_ptr<ShardManager> shard_manager_;
-        std::unique_ptr<TTLIndex> ttl_index_;
         std::unique_ptr<eviction::EvictionManager> eviction_manager_;
     };
 } // namespace kvmemo::core
@@ -0,0 +1,290 @@
+#pragma once
+/**
+ * @file lock_free_index.h
+ * @brief Hash index over records that readers probe without a lock.
+ *
+ * Responsibilities :
+ *    - Map a key to its record for readers inside an EpochGuard.
+ *    - Let a single (externally serialized) writer insert, replace and
+ *      erase records and grow the table.
+ *
+ * Design :
+ *   > Open addressing with linear probing over an array of atomic record
+ *     pointers. Erased slots hold a tombstone so probe chains stay intact;
+ *     inserts reuse the first tombstone they pass.
+ *   > A record is published with a release store of its pointer, so a
+ *     reader that loads it (acquire) sees its fully written key and value.
+ *   > Growing copies the live pointers into a new table, publishes it and
+ *     hands the old one back to the caller to retire. Readers still on the
+ *     old table see a snapshot that was valid when they entered.
+ *   > The index does not own records; the caller retires them after
+ *     Erase() / Replace().
+ *
+ *  Thread Safety :
+ *   => Find() is lock-free and may run concurrently with the writer.
+ *   => Insert(), Replace(), Erase() and Clear() need external
+ *      serialization.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+
+#include "../common/memory.h"
+
+namespace kvmemo::core
+{
+    /**
+     * @brief Lock-free readable index over records of type T.
+     *
+     *  T provides Key() (std::string_view) and Hash().
+     */
+    template <typename T>
+    class LockFreeIndex final
+    {
+    public:
+        /**
+         * @brief One slot array. Freed with Table::Destroy once retired.
+         */
+        class Table final
+        {
+        public:
+            static Table *Create(std::size_t capacity)
+            {
+                void *memory = ::operator new(sizeof(Table) + capacity * sizeof(std::atomic<T *>));
+                Table *table = new (memory) Table(capacity);
+
+                for (std::size_t i = 0; i < capacity; ++i)
+                {
+                    new (&table->Slots()[i]) std::atomic<T *>(nullptr);
+                }
+                return table;
+            }
+
+            static void Destroy(Table *table) noexcept
+            {
+                table->~Table();
+                ::operator delete(table);
+            }
+
+            std::size_t Capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            /**
+             * @brief Heap bytes of this table, as allocated.
+             */
+            std::size_t AllocatedBytes() const noexcept
+            {
+                return common::AllocatedBytes(sizeof(Table) + Capacity() * sizeof(std::atomic<T *>));
+            }
+
+            std::atomic<T *> &Slot(std::size_t index) noexcept
+            {
+                return Slots()[index & mask_];
+            }
+
+        private:
+            explicit Table(std::size_t capacity) noexcept : mask_(capacity - 1) {}
+
+            std::atomic<T *> *Slots() noexcept
+            {
+                return reinterpret_cast<std::atomic<T *> *>(this + 1);
+            }
+
+            const std::size_t mask_;
+        };
+
+        static constexpr std::size_t kMinCapacity = 16;
+
+        LockFreeIndex() : table_(Table::Create(kMinCapacity)) {}
+
+        LockFreeIndex(const LockFreeIndex &) = delete;
+        LockFreeIndex &operator=(const LockFreeIndex &) = delete;
+
+        LockFreeIndex(LockFreeIndex &&) = delete;
+        LockFreeIndex &operator=(LockFreeIndex &&) = delete;
+
+        ~LockFreeIndex()
+        {
+            Table::Destroy(table_.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Returns the record for @p key or nullptr. The caller must
+         *        hold an EpochGuard for as long as it uses the result.
+         */
+        T *Find(std::string_view key, std::size_t hash) const noexcept
+        {
+            Table *table = table_.load(std::memory_order_acquire);
+
+            for (std::size_t i = hash, probes = 0; probes < table->Capacity(); ++i, ++probes)
+            {
+                T *record = table->Slot(i).load(std::memory_order_acquire);
+
+                if (record == nullptr)
+                {
+                    return nullptr;
+                }
+
+                if (record != Tombstone() && record->Hash() == hash && record->Key() == key)
+                {
+                    return record;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * @brief Publishes @p record, whose key must not be present.
+         * @return The previous table if the index grew (retire it), else
+         *         nullptr.
+         */
+        Table *Insert(T *record)
+        {
+            Table *retired = nullptr;
+            if ((used_ + 1) * 4 > Current()->Capacity() * 3)
+            {
+                retired = Rebuild((size_ + 1) * 2);
+            }
+
+            Table *table = Current();
+            for (std::size_t i = record->Hash();; ++i)
+            {
+                std::atomic<T *> &slot = table->Slot(i);
+                T *current = slot.load(std::memory_order_relaxed);
+
+                if (current == nullptr || current == Tombstone())
+                {
+                    used_ += current == nullptr ? 1 : 0;
+                    ++size_;
+                    slot.store(record, std::memory_order_release);
+                    return retired;
+                }
+            }
+        }
+
+        /**
+         * @brief Swaps @p old_record for @p record (same key) in one store.
+         */
+        void Replace(T *old_record, T *record) noexcept
+        {
+            SlotOf(old_record).store(record, std::memory_order_release);
+        }
+
+        /**
+         * @brief Unpublishes @p record.
+         */
+        void Erase(T *record) noexcept
+        {
+            SlotOf(record).store(Tombstone(), std::memory_order_release);
+            --size_;
+        }
+
+        /**
+         * @brief Unpublishes every record.
+         * @return The previous table; retire it.
+         */
+        Table *Clear()
+        {
+            Table *old_table = Current();
+            table_.store(Table::Create(kMinCapacity), std::memory_order_release);
+            used_ = 0;
+            size_ = 0;
+            return old_table;
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Heap bytes of the current table, as allocated.
+         */
+        std::size_t AllocatedBytes() const noexcept
+        {
+            return Current()->AllocatedBytes();
+        }
+
+    private:
+        static T *Tombstone() noexcept
+        {
+            return reinterpret_cast<T *>(alignof(T));
+        }
+
+        Table *Current() const noexcept
+        {
+            return table_.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<T *> &SlotOf(const T *record) noexcept
+        {
+            Table *table = Current();
+            for (std::size_t i = record->Hash();; ++i)
+            {
+                std::atomic<T *> &slot = table->Slot(i);
+                if (slot.load(std::memory_order_relaxed) == record)
+                {
+                    return slot;
+                }
+            }
+        }
+
+        /**
+         * @brief Copies live records into a table sized for @p live and
+         *        publishes it; returns the old table.
+         */
+        Table *Rebuild(std::size_t live)
+        {
+            std::size_t capacity = kMinCapacity;
+            while (capacity * 3 < live * 4)
+            {
+                capacity *= 2;
+            }
+
+            Table *old_table = Current();
+            Table *table = Table::Create(capacity);
+
+            for (std::size_t i = 0; i < old_table->Capacity(); ++i)
+            {
+                T *record = old_table->Slot(i).load(std::memory_order_relaxed);
+                if (record == nullptr || record == Tombstone())
+                {
+                    continue;
+                }
+
+                std::size_t j = record->Hash();
+                while (table->Slot(j).load(std::memory_order_relaxed) != nullptr)
+                {
+                    ++j;
+                }
+                table->Slot(j).store(record, std::memory_order_relaxed);
+            }
+
+            table_.store(table, std::memory_order_release);
+            used_ = size_;
+            return old_table;
+        }
+
+        std::atomic<Table *> table_;
+
+        // Writer-only bookkeeping: non-empty slots (live + tombstones) and
+        // live records in the current table.
+        std::size_t used_{0};
+        std::size_t size_{0};
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -0,0 +1,384 @@
+#pragma once
+/**
+ * @file record.h
+ * @brief Variable-length storage record for one key.
+ *
+ * Responsibilities :
+ *    - Hold the key bytes, value bytes and Entry timestamps in a single
+ *      heap allocation.
+ *    - Carry the intrusive LRU and TTL links so every shard index refers
+ *      to the record by pointer instead of storing its own key copy.
+ *
+ * Layout :
+ *   [ LRUHook | TTLHook | hash | created_at | sizes, access clock, flags ][ key ][ value ... ]
+ *   > The value area may be larger than the value; an overwrite that fits
+ *     (and would not leave most of a large area unused) is copied in place.
+ *   > Values of kSharedValueThreshold bytes or more live in a separate
+ *     common::Blob whose handle takes the value area. ShareValue() hands
+ *     out another reference, so a GET of a large value copies no bytes and
+ *     the reply stays valid after the record is overwritten or freed.
+ *   > The access clock is a 24-bit millisecond timestamp of the last read
+ *     or write (after Redis's per-object LRU clock). It wraps every ~4.6
+ *     hours; IdleTime() is taken modulo the wrap. Stamping it is a single
+ *     relaxed store, so readers holding no lock can keep it current.
+ *
+ *  Thread Safety :
+ *   => Not thread-safe
+ *   => Owned and synchronized by Shard.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+
+#include "../common/blob.h"
+#include "../common/memory.h"
+#include "intrusive_lru.h"
+#include "ttl_index.h"
+
+namespace kvmemo::core
+{
+    /**
+     * @brief Key, value and expiry metadata in one allocation.
+     *
+     *  Created only through Create(); the bytes follow the header, so a
+     *  Record is neither copyable nor movable.
+     */
+    class Record final : public LRUHook, public TTLHook
+    {
+    public:
+        using Timestamp = std::uint64_t;
+
+        struct Deleter
+        {
+            void operator()(Record *record) const noexcept
+            {
+                Destroy(record);
+            }
+        };
+
+        using Ptr = std::unique_ptr<Record, Deleter>;
+
+        /**
+         * @brief Values at least this large are stored as a shared Blob.
+         *        Matches the size from which the output queue sends a
+         *        reply segment without copying it.
+         */
+        static constexpr std::size_t kSharedValueThreshold = 16 * 1024;
+
+        /**
+         * @brief Width of the access clock; IdleTime() is below 2^24 ms.
+         */
+        static constexpr std::size_t kAccessClockBits = 24;
+        static constexpr std::uint32_t kAccessClockMask = (std::uint32_t{1} << kAccessClockBits) - 1;
+
+        /**
+         * @brief Allocates a record holding copies of @p key and @p value.
+         *
+         * @param expire_at Absolute expiry in epoch milliseconds, 0 for none.
+         */
+        static Ptr Create(std::string_view key,
+                          std::size_t hash,
+                          std::string_view value,
+                          Timestamp created_at,
+                          Timestamp expire_at)
+        {
+            if (key.size() > kMaxSize || value.size() > kMaxSize)
+            {
+                throw std::length_error("Record key or value too large");
+            }
+
+            const bool shared = value.size() >= kSharedValueThreshold;
+            common::Blob blob = shared ? common::Blob::Copy(value) : common::Blob();
+
+            const std::size_t value_capacity =
+                shared ? RoundUp(key.size()) + sizeof(common::Blob) - key.size()
+                       : RoundUp(key.size() + value.size()) - key.size();
+            void *memory = ::operator new(sizeof(Record) + key.size() + value_capacity);
+
+            Record *record = new (memory) Record(hash,
+                                                 static_cast<std::uint32_t>(key.size()),
+                                                 static_cast<std::uint16_t>(value_capacity),
+                                                 shared);
+            if (!key.empty())
+            {
+                std::memcpy(record->Bytes(), key.data(), key.size());
+            }
+
+            if (shared)
+            {
+                new (record->SharedSlot()) common::Blob(std::move(blob));
+                record->value_size_ = static_cast<std::uint32_t>(value.size());
+            }
+            else
+            {
+                record->CopyValue(value);
+            }
+            record->SetExpiry(created_at, expire_at);
+            record->Touch(created_at);
+
+            return Ptr(record);
+        }
+
+        static void Destroy(Record *record) noexcept
+        {
+            if (record != nullptr)
+            {
+                if (record->shared_value_)
+                {
+                    record->SharedSlot()->~Blob();
+                }
+                record->~Record();
+                ::operator delete(record);
+            }
+        }
+
+        Record(const Record &) = delete;
+        Record &operator=(const Record &) = delete;
+
+        Record(Record &&) = delete;
+        Record &operator=(Record &&) = delete;
+
+        std::string_view Key() const noexcept
+        {
+            return {Bytes(), key_size_};
+        }
+
+        std::string_view Value() const noexcept
+        {
+            return shared_value_ ? SharedSlot()->View()
+                                 : std::string_view(Bytes() + key_size_, value_size_);
+        }
+
+        /**
+         * @brief The value as a Blob: another reference to the stored
+         *        bytes for large values, a fresh copy for small ones
+         *        (held in the handle, without allocating, up to
+         *        Blob::kInlineCapacity bytes).
+         */
+        common::Blob ShareValue() const
+        {
+            return shared_value_ ? *SharedSlot() : common::Blob::Copy(Value());
+        }
+
+        std::size_t Hash() const noexcept
+        {
+            return hash_;
+        }
+
+        /**
+         * @brief Overwrites the value in place.
+         *
+         * @return false if @p value does not fit (or would leave most of
+         *         the value area unused), or either value is large enough
+         *         to be shared; the caller must Create() a replacement
+         *         record instead.
+         */
+        bool AssignValue(std::string_view value) noexcept
+        {
+            if (shared_value_ || value.size() >= kSharedValueThreshold ||
+                value.size() > value_capacity_ ||
+                value_capacity_ - value.size() > value_capacity_ / 2 + kInPlaceSlack)
+            {
+                return false;
+            }
+
+            CopyValue(value);
+            return true;
+        }
+
+        /**
+         * @brief Heap bytes owned by this record, including its share of
+         *        a large value.
+         */
+        std::size_t AllocationSize() const noexcept
+        {
+            const std::size_t own = sizeof(Record) + key_size_ + value_capacity_;
+            return shared_value_ ? own + SharedSlot()->AllocationSize() : own;
+        }
+
+        /**
+         * @brief What this record costs the store: its key and value bytes,
+         *        and as overhead everything else the allocator hands out
+         *        for it (header, padding, spare value capacity, size-class
+         *        rounding, and the Blob block of a large value).
+         */
+        common::MemoryUsage Usage() const noexcept
+        {
+            std::size_t allocated =
+                common::AllocatedBytes(sizeof(Record) + key_size_ + value_capacity_);
+            if (shared_value_)
+            {
+                allocated += common::AllocatedBytes(SharedSlot()->AllocationSize());
+            }
+
+            common::MemoryUsage usage;
+            usage.key_bytes = key_size_;
+            usage.value_bytes = value_size_;
+            usage.overhead_bytes = allocated - key_size_ - value_size_;
+            return usage;
+        }
+
+        /**
+         * @param expire Absolute expiry in epoch milliseconds, 0 for none.
+         */
+        void SetExpiry(Timestamp created_at, Timestamp expire) noexcept
+        {
+            created_at_ = created_at;
+            TTLHook::expire_at = expire;
+        }
+
+        Timestamp CreatedAt() const noexcept
+        {
+            return created_at_;
+        }
+
+        /**
+         * @brief Returns expiration Timestamp (0 if no TTL)
+         */
+        Timestamp ExpireAt() const noexcept
+        {
+            return TTLHook::expire_at;
+        }
+
+        bool HasTTL() const noexcept
+        {
+            return TTLHook::expire_at != 0;
+        }
+
+        bool IsExpired(Timestamp now) const noexcept
+        {
+            return HasTTL() && now >= TTLHook::expire_at;
+        }
+
+        /**
+         * @brief Access clock value for epoch milliseconds @p now.
+         */
+        static std::uint32_t AccessClock(Timestamp now) noexcept
+        {
+            return static_cast<std::uint32_t>(now) & kAccessClockMask;
+        }
+
+        /**
+         * @brief Stamps the access clock with @p now; safe from lock-free
+         *        readers. Skips the store when the stamp is unchanged so
+         *        hot records do not keep their cache line dirty.
+         */
+        void Touch(Timestamp now) noexcept
+        {
+            const std::uint32_t clock = AccessClock(now);
+            if (access_clock_.load(std::memory_order_relaxed) != clock)
+            {
+                access_clock_.store(clock, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Milliseconds since the last Touch(), modulo 2^24.
+         */
+        std::uint32_t IdleTime(Timestamp now) const noexcept
+        {
+            return (AccessClock(now) - access_clock_.load(std::memory_order_relaxed)) & kAccessClockMask;
+        }
+
+        /**
+         * @brief Sets the reference bit; safe from lock-free readers.
+         */
+        void MarkAccessed() noexcept
+        {
+            if (accessed_.load(std::memory_order_relaxed) == 0)
+            {
+                accessed_.store(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Clears the reference bit and returns its previous value.
+         */
+        bool ClearAccessed() noexcept
+        {
+            return accessed_.exchange(0, std::memory_order_relaxed) != 0;
+        }
+
+    private:
+        static constexpr std::size_t kMaxSize = std::numeric_limits<std::uint32_t>::max();
+
+        // Small values may shrink in place regardless of the half rule.
+        static constexpr std::size_t kInPlaceSlack = 16;
+
+        // Only values below kSharedValueThreshold are stored inline, so the
+        // value area always fits 16 bits (which keeps the header at 80 bytes).
+        static_assert(kSharedValueThreshold + alignof(LRUHook) <= std::numeric_limits<std::uint16_t>::max(),
+                      "value_capacity_ is too narrow for inline values");
+
+        static std::size_t RoundUp(std::size_t bytes) noexcept
+        {
+            return (bytes + alignof(Record) - 1) & ~(alignof(Record) - 1);
+        }
+
+        Record(std::size_t hash, std::uint32_t key_size, std::uint16_t value_capacity, bool shared) noexcept
+            : hash_(hash), key_size_(key_size), value_capacity_(value_capacity), shared_value_(shared) {}
+
+        ~Record() = default;
+
+        char *Bytes() noexcept
+        {
+            return reinterpret_cast<char *>(this + 1);
+        }
+
+        const char *Bytes() const noexcept
+        {
+            return reinterpret_cast<const char *>(this + 1);
+        }
+
+        // The Blob handle of a shared value, placed after the padded key.
+        common::Blob *SharedSlot() noexcept
+        {
+            return reinterpret_cast<common::Blob *>(Bytes() + RoundUp(key_size_));
+        }
+
+        const common::Blob *SharedSlot() const noexcept
+        {
+            return reinterpret_cast<const common::Blob *>(Bytes() + RoundUp(key_size_));
+        }
+
+        void CopyValue(std::string_view value) noexcept
+        {
+            if (!value.empty())
+            {
+                std::memcpy(Bytes() + key_size_, value.data(), value.size());
+            }
+            value_size_ = static_cast<std::uint32_t>(value.size());
+        }
+
+        const std::size_t hash_;
+        Timestamp created_at_{0};
+        const std::uint32_t key_size_;
+        std::uint32_t value_size_{0};
+
+        // Low kAccessClockBits of the epoch milliseconds of the last access.
+        std::atomic<std::uint32_t> access_clock_{0};
+
+        const std::uint16_t value_capacity_;
+
+        // Set by lock-free GETs, which cannot move the record in the LRU.
+        std::atomic<std::uint8_t> accessed_{0};
+
+        // The value area holds a common::Blob handle instead of bytes.
+        const bool shared_value_;
+    };
+} // namespace kvmemo::core
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
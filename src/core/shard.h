@@ -4,71 +4,488 @@
  * @brief Respresents a single shard in the KV engine.
  *
  *  Responsibilities :
- *  - Store Key -> Entry mappings
+ *  - Store Key -> Record mappings
  *  - Enforce thread-safety at shard level
  *  - Integrate LRU eviction tracking
  *  - Provide atomic key operations
  *
+ *  Storage :
+ *  > Each key lives in one variable-length Record (see record.h) holding
+ *    the key and value bytes, the expiry timestamps and the intrusive LRU
+ *    and TTL links. store_ indexes records by a view of their own key and
+ *    the LRU list and timing wheel link them directly, so no index keeps
+ *    a second copy of the key and a SET of a new key allocates once.
+ *
  *  Thread Safety :
- *  > Fully thread-safe using internal mutex.
+ *  > Fully thread-safe using an internal shared_mutex.
  *  > All public APIs are safe for concurrent access.
+ *  > Get(), Size() and GetAllKeys() take the lock shared, so readers of
+ *    one shard run in parallel. A GET hit does not touch the LRU list; it
+ *    notes the record in a lossy AccessBuffer that the next writer
+ *    replays under the exclusive lock before it changes anything, so a
+ *    buffered record is always still alive when it is moved to front.
+ *  > With ReadMode::kLockFree, Get() takes no lock at all. Writers still
+ *    serialize on the mutex but also publish records in a LockFreeIndex
+ *    that readers probe inside an EpochGuard. Records are never modified
+ *    once published (an overwrite publishes a replacement), and removed
+ *    records are retired to an epoch RetireList instead of being freed
+ *    while a reader may still be copying them. A hit sets the record's
+ *    reference bit, which eviction honours as a second chance.
+ *  > Retired records and tables stay charged to the memory tracker until
+ *    they are freed: by writes once enough have built up, and by
+ *    ReclaimRetired() from the background threads otherwise.
+ *  > GetShared() returns large values as a reference to the record's Blob,
+ *    so the read-side critical section never copies their bytes.
+ *  > With AccessTracking::kSampled a hit, in either read mode, only stamps
+ *    the record's access clock (one relaxed store). Recency is then
+ *    estimated by Sample()ing records and comparing their IdleTime(), as
+ *    the sampled LRU policy does; the LRU list keeps write order only.
+ *
+ *  Memory :
+ *  > usage_ holds the shard's exact footprint: each record's Usage() (key
+ *    and value bytes, header, padding and allocator rounding) plus the
+ *    index tables. Every path that adds, resizes or frees a record
+ *    (write, overwrite, delete, lazy and active expiry, eviction, clear)
+ *    or grows an index applies the delta under the lock, and forwards
+ *    its total to the attached MemoryTracker.
  *
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
-#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 
-#include "entry.h"
-#include "lru_cache.h"
+#include "../common/blob.h"
+#include "../common/memory.h"
+#include "../common/time.h"
+#include "../eviction/memory_tracker.h"
+#include "access_buffer.h"
+#include "epoch.h"
+#include "flat_hash_map.h"
+#include "intrusive_lru.h"
+#include "lock_free_index.h"
+#include "record.h"
 #include "ttl_index.h"
 
 namespace kvmemo::core
 {
+    /**
+     * @brief How Shard::Get synchronizes with writers.
+     */
+    enum class ReadMode : std::uint8_t
+    {
+        kShared = 0,   // shared lock; hits buffered for the LRU
+        kLockFree = 1, // no lock; epoch-protected index, reference bits
+    };
+
+    /**
+     * @brief What a GET hit records for eviction.
+     */
+    enum class AccessTracking : std::uint8_t
+    {
+        kOrdered = 0, // hits move the record in the LRU list (see ReadMode)
+        kSampled = 1, // hits stamp the record's access clock only
+    };
 
     class Shard final
     {
     public:
-        using Key = std::string;
+        using Key = std::string_view;
 
     private:
+        using Timestamp = Record::Timestamp;
+        using Store = FlatHashMap<std::string_view, Record::Ptr>;
+        using Index = LockFreeIndex<Record>;
+
+        // Retired records are freed in batches of at least this many, or
+        // once they hold this many bytes; background ticks free the rest
+        // (ReclaimRetired()).
+        static constexpr std::size_t kReclaimBatch = 64;
+        static constexpr std::size_t kReclaimBytes = 1 << 20;
+
         const std::size_t capacity_;
-        mutable std::mutex mutex_;
+        const ReadMode read_mode_;
+        const AccessTracking tracking_;
+        mutable std::shared_mutex mutex_;
+
+        Store store_;
+        IntrusiveLRU<Record> lru_;
+        TimingWheel<Record> ttl_wheel_;
+
+        // GET hits made under the shared lock, not yet applied to lru_.
+        AccessBuffer<Record> accesses_;
+
+        // Bytes held by records and index tables; index_bytes_ and
+        // retired_bytes_ are the parts of usage_.overhead_bytes charged
+        // for the index tables and for retired_ until it frees them.
+        common::MemoryUsage usage_;
+        std::size_t index_bytes_{0};
+        std::size_t retired_bytes_{0};
+
+        // Receives every change of usage_.Total() in memory_partition_;
+        // may be null.
+        eviction::MemoryTracker *memory_tracker_{nullptr};
+        std::size_t memory_partition_{0};
+
+        // ReadMode::kLockFree only: what lock-free readers probe, and the
+        // records / tables unlinked from it awaiting their grace period.
+        Index index_;
+        RetireList retired_;
+
+        /**
+         * @brief Replays buffered GET hits into lru_. Every exclusive
+         *        section calls this before it can free a record.
+         */
+        void ApplyAccesses() noexcept
+        {
+            accesses_.Drain([this](Record *record)
+                            { lru_.MoveToFront(record); });
+        }
+
+        /**
+         * @brief Stores @p value under @p key as the most recently used
+         *        record, creating the record (and evicting the LRU tail on
+         *        overflow) if absent.
+         *
+         * @param expire_at Absolute expiry, 0 for none.
+         */
+        void Write(Key key, std::string_view value, Timestamp expire_at)
+        {
+            const Timestamp now = common::CoarseClock::Now();
+            const std::size_t hash = Store::hash_of(key);
+
+            auto it = store_.find(key, hash);
+            if (it == store_.end())
+            {
+                Record::Ptr owned = Record::Create(key, hash, value, now, expire_at);
+                Record *record = owned.get();
+
+                store_.try_emplace(record->Key(), std::move(owned));
+                AddUsage(*record);
+                if (read_mode_ == ReadMode::kLockFree)
+                {
+                    RetireTable(index_.Insert(record));
+                }
+                SyncIndexUsage();
+                lru_.PushFront(record);
+                Reschedule(record);
+
+                if (store_.size() > capacity_)
+                {
+                    EvictOne();
+                }
+                return;
+            }
+
+            Record *record = it->second.get();
+
+            // Lock-free readers may be copying the old value, so in that
+            // mode every overwrite publishes a new record.
+            const common::MemoryUsage before = record->Usage();
+            if (read_mode_ == ReadMode::kShared && record->AssignValue(value))
+            {
+                Discharge(before);
+                AddUsage(*record);
+                record->SetExpiry(now, expire_at);
+                record->Touch(now);
+                lru_.MoveToFront(record);
+            }
+            else
+            {
+                Record::Ptr replacement = Record::Create(key, hash, value, now, expire_at);
+
+                lru_.Remove(record);
+                ttl_wheel_.Cancel(record);
+                if (read_mode_ == ReadMode::kLockFree)
+                {
+                    index_.Replace(record, replacement.get());
+                }
+
+                // Same bytes and hash: only the slot's view must move to
+                // the replacement before the old record is released.
+                Record::Ptr old = std::move(it->second);
+                it->first = replacement->Key();
+                it->second = std::move(replacement);
+                AddUsage(*it->second);
+                RemoveUsage(*old);
+                Dispose(std::move(old));
+
+                record = it->second.get();
+                lru_.PushFront(record);
+            }
+
+            Reschedule(record);
+        }
+
+        void Reschedule(Record *record) noexcept
+        {
+            if (record->HasTTL())
+            {
+                ttl_wheel_.Schedule(record);
+            }
+            else
+            {
+                ttl_wheel_.Cancel(record);
+            }
+        }
+
+        void RemoveInternal(Store::iterator it)
+        {
+            Record *record = it->second.get();
+
+            lru_.Remove(record);
+            ttl_wheel_.Cancel(record);
+            if (read_mode_ == ReadMode::kLockFree)
+            {
+                index_.Erase(record);
+            }
+
+            RemoveUsage(*record);
+            Dispose(std::move(it->second));
+            store_.erase(it);
+        }
+
+        void Charge(const common::MemoryUsage &usage) noexcept
+        {
+            usage_ += usage;
+            if (memory_tracker_ != nullptr)
+            {
+                memory_tracker_->Reserve(memory_partition_, usage.Total());
+            }
+        }
 
-        std::unordered_map<Key, Entry> store_;
-        LRUCache lru_;
-        TTLIndex ttl_index_;
+        void Discharge(const common::MemoryUsage &usage) noexcept
+        {
+            usage_ -= usage;
+            if (memory_tracker_ != nullptr)
+            {
+                memory_tracker_->Release(memory_partition_, usage.Total());
+            }
+        }
 
-        void RemoveInternal(const Key &key)
+        void AddUsage(const Record &record) noexcept
         {
-            store_.erase(key);
-            lru_.Remove(key);
-            ttl_index_.Remove(key);
+            Charge(record.Usage());
+        }
+
+        void RemoveUsage(const Record &record) noexcept
+        {
+            Discharge(record.Usage());
+        }
+
+        /**
+         * @brief Charges the index tables' current size, after an insert
+         *        or Clear() may have reallocated them.
+         */
+        void SyncIndexUsage() noexcept
+        {
+            std::size_t bytes = store_.allocated_bytes();
+            if (read_mode_ == ReadMode::kLockFree)
+            {
+                bytes += index_.AllocatedBytes();
+            }
+
+            if (bytes != index_bytes_)
+            {
+                common::MemoryUsage index;
+                index.overhead_bytes = index_bytes_;
+                Discharge(index);
+
+                index.overhead_bytes = bytes;
+                Charge(index);
+                index_bytes_ = bytes;
+            }
+        }
+
+        /**
+         * @brief Charges the bytes retired_ still holds, after a retire or
+         *        reclaim changed them; a retired record stays counted until
+         *        it is actually freed.
+         */
+        void SyncRetiredUsage() noexcept
+        {
+            const std::size_t bytes = retired_.Bytes();
+            if (bytes != retired_bytes_)
+            {
+                common::MemoryUsage retired;
+                retired.overhead_bytes = retired_bytes_;
+                Discharge(retired);
+
+                retired.overhead_bytes = bytes;
+                Charge(retired);
+                retired_bytes_ = bytes;
+            }
+        }
+
+        /**
+         * @brief Frees a record no index refers to any more, or in
+         *        lock-free mode retires it until readers are done with it.
+         */
+        void Dispose(Record::Ptr record)
+        {
+            if (read_mode_ != ReadMode::kLockFree)
+            {
+                return;
+            }
+
+            const std::size_t bytes = record->Usage().Total();
+            retired_.Retire<Record, &Record::Destroy>(record.release(), bytes);
+            if (retired_.Size() >= kReclaimBatch || retired_.Bytes() >= kReclaimBytes)
+            {
+                retired_.Reclaim();
+            }
+            SyncRetiredUsage();
+        }
+
+        void RetireTable(Index::Table *table)
+        {
+            if (table != nullptr)
+            {
+                retired_.Retire<Index::Table, &Index::Table::Destroy>(table, table->AllocatedBytes());
+                SyncRetiredUsage();
+            }
+        }
+
+        /**
+         * @brief The record to evict next: the LRU tail. In lock-free mode
+         *        GETs only set the record's reference bit, so a referenced
+         *        tail gets a second chance at the front (CLOCK) instead.
+         *        With sampled tracking the tail is the least recently
+         *        written record.
+         */
+        Record *Victim()
+        {
+            Record *victim = lru_.Back();
+
+            if (read_mode_ == ReadMode::kLockFree && tracking_ == AccessTracking::kOrdered)
+            {
+                for (std::size_t i = lru_.Size(); i > 0 && victim->ClearAccessed(); --i)
+                {
+                    lru_.MoveToFront(victim);
+                    victim = lru_.Back();
+                }
+            }
+
+            return victim;
         }
 
         void EvictOne()
         {
-            if (store_.empty())
+            Record *victim = Victim();
+            if (victim == nullptr)
             {
                 return;
             }
 
-            Key victim = lru_.PopEvictionCandidate();
-            store_.erase(victim);
-            ttl_index_.Remove(victim);
+            RemoveInternal(store_.find(victim->Key(), victim->Hash()));
+        }
+
+        /**
+         * @brief Finds a live record for @p key and returns @p extract
+         *        applied to it while the record is protected (shared lock
+         *        or epoch guard). An expired record is removed under the
+         *        exclusive lock instead, and @p expired (if given) is set.
+         */
+        template <typename Extract>
+        auto Lookup(Key key, Extract &&extract, bool *expired)
+            -> std::optional<decltype(extract(std::declval<const Record &>()))>
+        {
+            const Timestamp now = common::CoarseClock::Now();
+
+            if (read_mode_ == ReadMode::kLockFree)
+            {
+                EpochGuard guard;
+
+                Record *record = index_.Find(key, Store::hash_of(key));
+                if (record == nullptr)
+                {
+                    return std::nullopt;
+                }
+
+                if (!record->IsExpired(now))
+                {
+                    if (tracking_ == AccessTracking::kSampled)
+                    {
+                        record->Touch(now);
+                    }
+                    else
+                    {
+                        record->MarkAccessed();
+                    }
+                    return extract(*record);
+                }
+            }
+            else
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+
+                auto it = store_.find(key);
+                if (it == store_.end())
+                {
+                    return std::nullopt;
+                }
+
+                Record *record = it->second.get();
+
+                if (!record->IsExpired(now))
+                {
+                    if (tracking_ == AccessTracking::kSampled)
+                    {
+                        record->Touch(now);
+                    }
+                    else
+                    {
+                        accesses_.Record(record);
+                    }
+                    return extract(*record);
+                }
+            }
+
+            // Lazy expiry needs the exclusive lock; the key may have been
+            // rewritten since the shared lock was released.
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
+
+            auto it = store_.find(key);
+            if (it != store_.end() && it->second->IsExpired(now))
+            {
+                RemoveInternal(it);
+                if (expired != nullptr)
+                {
+                    *expired = true;
+                }
+            }
+
+            return std::nullopt;
         }
 
     public:
-        explicit Shard(std::size_t capacity)
+        explicit Shard(std::size_t capacity,
+                       ReadMode read_mode = ReadMode::kShared,
+                       AccessTracking tracking = AccessTracking::kOrdered)
             : capacity_(capacity),
-              lru_(capacity),
-              ttl_index_() {}
+              read_mode_(read_mode),
+              tracking_(tracking)
+        {
+            if (capacity_ == 0)
+            {
+                throw std::invalid_argument("Shard capacity must be greater than zero");
+            }
+
+            SyncIndexUsage();
+        }
 
         Shard(const Shard &) = delete;
         Shard &operator=(const Shard &) = delete;
@@ -79,44 +496,57 @@ namespace kvmemo::core
         ~Shard() = default;
 
         /**
-         * @brief Insert or Update key without TTL.
+         * @brief Reports every change of this shard's memory usage to
+         *        partition @p partition of @p tracker from now on (nullptr
+         *        detaches). Memory already in use moves from the previous
+         *        tracker to @p tracker.
          */
-        void Set(const Key &key, std::string value)
+        void TrackMemory(eviction::MemoryTracker *tracker, std::size_t partition = 0)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-
-            store_[key] = Entry(std::move(value));
-
-            bool overflow = lru_.Touch(key);
-            ttl_index_.Remove(key);
+            std::lock_guard<std::shared_mutex> lock(mutex_);
 
-            if (overflow)
+            if (memory_tracker_ != nullptr)
             {
-                EvictOne();
+                memory_tracker_->Release(memory_partition_, usage_.Total());
+            }
+            memory_tracker_ = tracker;
+            memory_partition_ = partition;
+            if (memory_tracker_ != nullptr)
+            {
+                memory_tracker_->Reserve(memory_partition_, usage_.Total());
             }
         }
 
         /**
-         * @brief Insert or update key with TTL (milliseconds).
+         * @brief Exact memory held by this shard's records and index,
+         *        split into key bytes, value bytes and overhead.
          */
-        void SetWithTTL(const Key &key, std::string value, std::uint64_t ttl_ms)
+        common::MemoryUsage MemoryUsage() const
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return usage_;
+        }
 
-            Entry entry(std::move(value), ttl_ms);
-            store_[key] = entry;
+        /**
+         * @brief Insert or Update key without TTL.
+         */
+        void Set(Key key, std::string_view value)
+        {
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
 
-            bool overflow = lru_.Touch(key);
+            Write(key, value, 0);
+        }
 
-            if (entry.HasTTL())
-            {
-                ttl_index_.Upsert(key, entry.ExpireAt());
-            }
+        /**
+         * @brief Insert or update key with TTL (milliseconds).
+         */
+        void SetWithTTL(Key key, std::string_view value, std::uint64_t ttl_ms)
+        {
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
 
-            if (overflow)
-            {
-                EvictOne();
-            }
+            Write(key, value, ttl_ms == 0 ? 0 : common::CoarseClock::Now() + ttl_ms);
         }
 
         /**
@@ -124,35 +554,155 @@ namespace kvmemo::core
          *
          * Return nullopt if
          *  - Key not found
-         *  - Key expired
+         *  - Key expired; it is removed and @p expired (if given) is set,
+         *    so the caller can tell its eviction policy
+         */
+        std::optional<std::string> Get(Key key, bool *expired = nullptr)
+        {
+            return Lookup(key, [](const Record &record)
+                          { return std::string(record.Value()); }, expired);
+        }
+
+        /**
+         * @brief Like Get(), but returns the value as a Blob. A large value
+         *        is shared with its record, so the lock is held only for a
+         *        refcount bump and the caller can send the bytes as they are.
          */
-        std::optional<std::string> Get(const Key &key)
+        std::optional<common::Blob> GetShared(Key key, bool *expired = nullptr)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            return Lookup(key, [](const Record &record)
+                          { return record.ShareValue(); }, expired);
+        }
+
+        /**
+         * @brief Remove Key from shard.
+         *
+         * @param expired Set to true if an expired record was removed.
+         * @return true if a live key was removed.
+         */
+        bool Delete(Key key, bool *expired = nullptr)
+        {
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
 
             auto it = store_.find(key);
             if (it == store_.end())
+            {
+                return false;
+            }
+
+            const bool live = !it->second->IsExpired(common::CoarseClock::Now());
+            RemoveInternal(it);
+            if (!live && expired != nullptr)
+            {
+                *expired = true;
+            }
+            return live;
+        }
+
+        /**
+         * @brief Frees the retired records and tables whose grace period
+         *        has passed. Writes do this as they go; background ticks
+         *        call it so a shard that stops taking writes still returns
+         *        them.
+         *
+         * @return Bytes still retired.
+         */
+        std::size_t ReclaimRetired()
+        {
+            if (read_mode_ != ReadMode::kLockFree)
+            {
+                return 0;
+            }
+
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            retired_.Reclaim();
+            SyncRetiredUsage();
+            return retired_.Bytes();
+        }
+
+        /**
+         * @brief Returns the least recently used key, or nullopt if empty.
+         */
+        std::optional<std::string> LeastRecentKey()
+        {
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
+
+            const Record *record = Victim();
+            if (record == nullptr)
             {
                 return std::nullopt;
             }
 
-            if (it->second.IsExpired())
+            return std::string(record->Key());
+        }
+
+        /**
+         * @brief Calls @p visit(key, idle) for up to @p count records taken
+         *        from consecutive index slots, starting at slot @p start
+         *        (modulo the table size) and wrapping around.
+         *
+         * idle is the record's IdleTime(); an expired record reports the
+         * largest idle time so it is evicted first. @p visit runs under the
+         * shared lock and must not call back into this shard.
+         *
+         * @return Number of records visited.
+         */
+        template <typename Visit>
+        std::size_t Sample(std::size_t start, std::size_t count, Visit &&visit) const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+
+            const std::size_t visits = std::min(count, store_.size());
+            if (visits == 0)
+            {
+                return 0;
+            }
+
+            const Timestamp now = common::CoarseClock::Now();
+            auto it = store_.from_slot(start % store_.capacity());
+            for (std::size_t i = 0; i < visits; ++i, ++it)
+            {
+                if (it == store_.end())
+                {
+                    it = store_.begin();
+                }
+
+                const Record &record = *it->second;
+                visit(record.Key(), record.IsExpired(now) ? Record::kAccessClockMask : record.IdleTime(now));
+            }
+
+            return visits;
+        }
+
+        /**
+         * @brief IdleTime() of @p key's record (see Sample()), or nullopt
+         *        if absent. Does not count as an access.
+         */
+        std::optional<std::uint32_t> IdleTime(Key key) const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+
+            auto it = store_.find(key);
+            if (it == store_.end())
             {
-                RemoveInternal(key);
                 return std::nullopt;
             }
 
-            lru_.Touch(key);
-            return it->second.Value();
+            const Timestamp now = common::CoarseClock::Now();
+            const Record &record = *it->second;
+            return record.IsExpired(now) ? Record::kAccessClockMask : record.IdleTime(now);
         }
 
         /**
-         * @brief Remove Key from shard.
+         * @brief Whether the store holds a record for @p key, expired or
+         *        not. Does not count as an access.
          */
-        void Delete(const Key &key)
+        bool Contains(Key key) const
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            RemoveInternal(key);
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return store_.find(key) != store_.end();
         }
 
         /**
@@ -160,27 +710,28 @@ namespace kvmemo::core
          */
         std::size_t Size() const
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::shared_lock<std::shared_mutex> lock(mutex_);
             return store_.size();
         }
 
-                /**
+        /**
          * @brief Retrieves all non-expired key-value pairs from this shard.
          *
          * @return Vector of (key, value) pairs for all live entries.
          */
         std::vector<std::pair<std::string, std::string>> GetAllKeys() const
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            std::shared_lock<std::shared_mutex> lock(mutex_);
 
             std::vector<std::pair<std::string, std::string>> result;
             result.reserve(store_.size());
 
-            for (const auto &[key, entry] : store_)
+            const Timestamp now = common::CoarseClock::Now();
+            for (const auto &[key, record] : store_)
             {
-                if (!entry.IsExpired())
+                if (!record->IsExpired(now))
                 {
-                    result.emplace_back(key, entry.Value());
+                    result.emplace_back(std::string(key), std::string(record->Value()));
                 }
             }
 
@@ -192,25 +743,59 @@ namespace kvmemo::core
          */
         void Clear()
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            store_.clear();
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            accesses_.Clear();
             lru_.Clear();
-            ttl_index_.Clear();
+            ttl_wheel_.Clear();
+
+            if (read_mode_ == ReadMode::kLockFree)
+            {
+                RetireTable(index_.Clear());
+            }
+            for (auto &entry : store_)
+            {
+                RemoveUsage(*entry.second);
+                Dispose(std::move(entry.second));
+            }
+            store_.clear();
+            SyncIndexUsage();
         }
 
         /**
          * @brief Performs TTL cleanup for expired keys.
+         * @param limit At most this many keys are removed; the rest are
+         *        left for the next call.
+         * @param expired_keys If given, the removed keys are appended to it.
+         * @return Number of keys removed.
          */
-        void CleanupExpired(std::uint64_t now)
+        std::size_t CleanupExpired(std::uint64_t now,
+                                   std::size_t limit = std::numeric_limits<std::size_t>::max(),
+                                   std::vector<std::string> *expired_keys = nullptr)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-
-            auto expired_keys = ttl_index_.CollectExpired(now);
+            std::lock_guard<std::shared_mutex> lock(mutex_);
+            ApplyAccesses();
 
-            for (const auto &key : expired_keys)
+            const auto expired = ttl_wheel_.CollectExpired(now, limit);
+            for (Record *record : expired)
             {
-                RemoveInternal(key);
+                auto it = store_.find(record->Key(), record->Hash());
+                if (expired_keys != nullptr)
+                {
+                    expired_keys->emplace_back(record->Key());
+                }
+
+                lru_.Remove(record);
+                if (read_mode_ == ReadMode::kLockFree)
+                {
+                    index_.Erase(record);
+                }
+
+                RemoveUsage(*record);
+                Dispose(std::move(it->second));
+                store_.erase(it);
             }
+
+            return expired.size();
         }
     };
 } // namespace kvmemo::core
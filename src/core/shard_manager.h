@@ -20,31 +20,41 @@
 
 #include <vector>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <stdexcept>
+#include <utility>
 
+#include "../common/blob.h"
+#include "../common/memory.h"
 #include "shard.h"
 
 namespace kvmemo::core {
     class ShardManager final {
         public:
-            using Key = std::string;
+            using Key = std::string_view;
 
             /**
              * @brief ShardManager
              * 
              * @param shard_count Number of shards (must be > 0)
              * @param shard_capacity Capacity per shard
+             * @param read_mode How each shard's Get() synchronizes with writers
+             * @param tracking What each shard's Get() records for eviction
              */
-            ShardManager(std::size_t shard_count, std::size_t shard_capacity) : shard_count_(shard_count) {
+            ShardManager(std::size_t shard_count,
+                         std::size_t shard_capacity,
+                         ReadMode read_mode = ReadMode::kShared,
+                         AccessTracking tracking = AccessTracking::kOrdered) : shard_count_(shard_count) {
                 if(shard_count == 0) {
                     throw std::invalid_argument("Shard count must be greater than zero");
                 }
 
                 shards_.reserve(shard_count_);
                 for(std::size_t i = 0; i<shard_count_; ++i) {
-                    shards_.emplace_back(std::make_unique<Shard>(shard_capacity));
+                    shards_.emplace_back(std::make_unique<Shard>(shard_capacity, read_mode, tracking));
                 }
             }
 
@@ -59,29 +69,39 @@ namespace kvmemo::core {
         /**
          * @brief Insert or update key without TTL.
          */
-        void Set(const Key& key, std::string value) {
-            GetShard(key).Set(key, std::move(value));
+        void Set(Key key, std::string_view value) {
+            GetShard(key).Set(key, value);
         }
 
         /**
          * @brief Insert or update key with TTL (milliseconds).
          */
-        void SetWithTTL(const Key& key, std::string value, std::uint64_t ttl_ms) {
-            GetShard(key).SetWithTTL(key, std::move(value), ttl_ms);
+        void SetWithTTL(Key key, std::string_view value, std::uint64_t ttl_ms) {
+            GetShard(key).SetWithTTL(key, value, ttl_ms);
         }
 
         /**
          * @brief Retrive value by key.
          */
-        std::optional<std::string> Get(const Key& key) {
-            return GetShard(key).Get(key);
+        std::optional<std::string> Get(Key key, bool* expired = nullptr) {
+            return GetShard(key).Get(key, expired);
+        }
+
+        /**
+         * @brief Get value by key without copying large values.
+         */
+        std::optional<common::Blob> GetShared(Key key, bool* expired = nullptr) {
+            return GetShard(key).GetShared(key, expired);
         }
 
         /**
          * @brief Delete key.
+         *
+         * @param expired Set to true if an expired record was removed.
+         * @return true if a live key was removed.
          */
-        void Delete(const Key& key) {
-            GetShard(key).Delete(key);
+        bool Delete(Key key, bool* expired = nullptr) {
+            return GetShard(key).Delete(key, expired);
         }
 
         /**
@@ -121,11 +141,99 @@ namespace kvmemo::core {
 
         /**
          * @brief Run TTL cleanup across all shards.
+         * @return Number of keys removed.
          */
-        void CleanupExpired(std::uint64_t now) {
+        std::size_t CleanupExpired(std::uint64_t now) {
+            std::size_t expired = 0;
             for (auto& shard : shards_) {
-                shard->CleanupExpired(now);
+                expired += shard->CleanupExpired(now);
+            }
+            return expired;
+        }
+
+        /**
+         * @brief Removes at most @p limit expired keys from shard @p index,
+         *        appending them to @p expired_keys if given.
+         */
+        std::size_t CleanupExpired(std::size_t index, std::uint64_t now, std::size_t limit,
+                                   std::vector<std::string>* expired_keys = nullptr) {
+            return shards_.at(index)->CleanupExpired(now, limit, expired_keys);
+        }
+
+        /**
+         * @brief Frees what every shard has retired and readers are done
+         *        with; see Shard::ReclaimRetired.
+         */
+        void ReclaimRetired() {
+            for (auto& shard : shards_) {
+                shard->ReclaimRetired();
+            }
+        }
+
+        /**
+         * @brief Returns the least recently used key of shard @p index.
+         */
+        std::optional<std::string> LeastRecentKey(std::size_t index) const {
+            return shards_.at(index)->LeastRecentKey();
+        }
+
+        /**
+         * @brief Samples up to @p count records of shard @p index; see
+         *        Shard::Sample.
+         */
+        template <typename Visit>
+        std::size_t Sample(std::size_t index, std::size_t start, std::size_t count, Visit&& visit) const {
+            return shards_.at(index)->Sample(start, count, std::forward<Visit>(visit));
+        }
+
+        /**
+         * @brief Whether @p key has a record; see Shard::Contains.
+         */
+        bool Contains(Key key) const {
+            return shards_[ShardIndex(key)]->Contains(key);
+        }
+
+        /**
+         * @brief Idle time of @p key without touching it; see
+         *        Shard::IdleTime.
+         */
+        std::optional<std::uint32_t> IdleTime(Key key) const {
+            return shards_[ShardIndex(key)]->IdleTime(key);
+        }
+
+        /**
+         * @brief Attaches @p tracker to every shard, shard i reporting to
+         *        partition i; see Shard::TrackMemory.
+         */
+        void TrackMemory(eviction::MemoryTracker* tracker) {
+            for (std::size_t i = 0; i < shards_.size(); ++i) {
+                shards_[i]->TrackMemory(tracker, i);
+            }
+        }
+
+        /**
+         * @brief Index of the shard that owns @p key.
+         */
+        std::size_t ShardIndex(Key key) const {
+            return hasher_(key) % shard_count_;
+        }
+
+        /**
+         * @brief Memory breakdown of shard @p index.
+         */
+        common::MemoryUsage MemoryUsage(std::size_t index) const {
+            return shards_.at(index)->MemoryUsage();
+        }
+
+        /**
+         * @brief Memory breakdown summed over all shards.
+         */
+        common::MemoryUsage MemoryUsage() const {
+            common::MemoryUsage total;
+            for (const auto& shard : shards_) {
+                total += shard->MemoryUsage();
             }
+            return total;
         }
 
         /**
@@ -139,9 +247,8 @@ namespace kvmemo::core {
         /**
          * @brief Determines shard index for a given key.
          */
-        Shard& GetShard(const Key& key) {
-            std::size_t index = hasher_(key) % shard_count_;
-            return *shards_[index];
+        Shard& GetShard(Key key) {
+            return *shards_[ShardIndex(key)];
         }
 
         const std::size_t shard_count_;
@@ -1,36 +1,319 @@
-#pragma once 
+#pragma once
 
 /**
  * @file ttl_index.h
  * @brief Maintains time-ordered expiration tracking for keys with TTL.
- * 
+ *
  *  Responsibilities :
  *  - Track expiration timestamps .
  *  - Provide efficient retrival of expired keys.
- *  
+ *
+ *  Design : hierarchical timing wheel
+ *  > 7 levels of 64 slots; a slot at level k spans 64^k milliseconds, so
+ *    the wheel covers 2^42 ms (~139 years) ahead of its cursor.
+ *  > A key is linked into the slot of the highest 6-bit digit in which
+ *    its expiry differs from the cursor. When the cursor reaches that
+ *    slot's start the slot is cascaded one level down, until the key sits
+ *    in a level-0 (1 ms) slot and expires.
+ *  > Upsert / Remove are O(1) (hash lookup + list unlink). Advancing jumps
+ *    straight to the next occupied slot using per-level occupancy
+ *    bitmaps, so idle time costs nothing and each key is cascaded at most
+ *    once per level.
+ *  > CollectExpired() accepts a key budget so a caller can bound the work
+ *    done per tick; the remainder is returned by the next call.
+ *  > TimingWheel<T> is intrusive: records carry their own TTLHook, so a
+ *    shard schedules its records without copying keys. TTLIndex adapts it
+ *    to string keys for callers that have no record of their own.
+ *
  *   Thread Safety :
  *  > NOT thread-safe.
  *  > Caller must ensure synchronization.
- * 
+ *
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
-#include <map>
-#include <unordered_map>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <cstdint>
 
+#include "flat_hash_map.h"
 
 namespace kvmemo::core {
 
+    /**
+     * @brief Links embedded in every record tracked by a TimingWheel.
+     */
+    struct TTLHook {
+        TTLHook* ttl_prev{nullptr};
+        TTLHook* ttl_next{nullptr};
+        std::uint64_t expire_at{0};
+        std::uint8_t ttl_level{0};
+        std::uint8_t ttl_slot{0};
+        bool ttl_linked{false};
+    };
+
+    /**
+     * @brief Intrusive hierarchical timing wheel over records of type T.
+     *
+     *  T derives from TTLHook and is scheduled by its expire_at. The wheel
+     *  does not own its records; the owner must Cancel() a record before
+     *  destroying it.
+     */
+    template <typename T>
+    class TimingWheel final {
+        public:
+        using Timestamp = std::uint64_t;
+
+        static constexpr std::size_t kLevels = 7;
+        static constexpr std::size_t kSlotBits = 6;
+        static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+
+        TimingWheel() = default;
+
+        // Linked records point at the wheel's slot heads.
+        TimingWheel(const TimingWheel&) = delete;
+        TimingWheel& operator=(const TimingWheel&) = delete;
+
+        TimingWheel(TimingWheel&&) = delete;
+        TimingWheel& operator=(TimingWheel&&) = delete;
+
+        ~TimingWheel() = default;
+
+        /**
+         * @brief Links @p record at its expire_at, re-linking it if it was
+         *        already scheduled.
+         */
+        void Schedule(T* record) noexcept {
+            TTLHook* node = record;
+            if(node->ttl_linked) {
+                Unlink(node);
+            } else {
+                ++size_;
+            }
+
+            Link(node);
+            node->ttl_linked = true;
+        }
+
+        /**
+         * @brief Unlinks @p record; no-op if it is not scheduled.
+         */
+        void Cancel(T* record) noexcept {
+            TTLHook* node = record;
+            if(!node->ttl_linked) {
+                return;
+            }
+
+            Unlink(node);
+            node->ttl_linked = false;
+            --size_;
+        }
+
+        /**
+         * @brief Unlinks and returns records due at or before @p now.
+         *
+         * @param limit At most this many records are returned; records left
+         *        over are returned by the next call.
+         */
+        std::vector<T*> CollectExpired(Timestamp now,
+                                       std::size_t limit = std::numeric_limits<std::size_t>::max()) {
+            std::vector<T*> expired;
+
+            Timestamp next = 0;
+            while(expired.size() < limit && NextEvent(next) && next <= now) {
+                cursor_ = next;
+                Cascade();
+
+                const std::size_t slot = Digit(cursor_, 0);
+                while(expired.size() < limit && slots_[0][slot] != nullptr) {
+                    TTLHook* node = slots_[0][slot];
+                    Unlink(node);
+                    node->ttl_linked = false;
+                    --size_;
+
+                    expired.push_back(static_cast<T*>(node));
+                }
+            }
+
+            if(expired.size() < limit && now > cursor_) {
+                // Nothing is due before `now`, so no slot needs cascading.
+                cursor_ = now;
+            }
+
+            return expired;
+        }
+
+        /**
+         * @brief Returns number of scheduled records.
+         */
+        std::size_t Size() const noexcept {
+            return size_;
+        }
+
+        /**
+         * @brief Forgets every record without touching them; use when the
+         *        records themselves are being destroyed.
+         */
+        void Clear() noexcept {
+            size_ = 0;
+            far_ = nullptr;
+            occupied_.fill(0);
+            for(auto& level : slots_) {
+                level.fill(nullptr);
+            }
+        }
+
+        private:
+        static constexpr std::size_t kFarLevel = kLevels;
+        static constexpr std::size_t kWheelBits = kLevels * kSlotBits;
+
+        static std::size_t Digit(Timestamp t, std::size_t level) noexcept {
+            return static_cast<std::size_t>(t >> (level * kSlotBits)) & (kSlots - 1);
+        }
+
+        TTLHook*& Head(std::size_t level, std::size_t slot) noexcept {
+            return level == kFarLevel ? far_ : slots_[level][slot];
+        }
+
+        void Link(TTLHook* node) noexcept {
+            std::size_t level = 0;
+            std::size_t slot = Digit(cursor_, 0);   // already due
+
+            if(node->expire_at > cursor_) {
+                const Timestamp diff = node->expire_at ^ cursor_;
+
+                if((diff >> kWheelBits) != 0) {
+                    level = kFarLevel;
+                    slot = 0;
+                } else {
+                    level = (63 - static_cast<std::size_t>(__builtin_clzll(diff))) / kSlotBits;
+                    slot = Digit(node->expire_at, level);
+                }
+            }
+
+            TTLHook*& head = Head(level, slot);
+
+            node->ttl_level = static_cast<std::uint8_t>(level);
+            node->ttl_slot = static_cast<std::uint8_t>(slot);
+            node->ttl_prev = nullptr;
+            node->ttl_next = head;
+            if(head != nullptr) {
+                head->ttl_prev = node;
+            }
+            head = node;
+
+            if(level != kFarLevel) {
+                occupied_[level] |= std::uint64_t{1} << slot;
+            }
+        }
+
+        void Unlink(TTLHook* node) noexcept {
+            TTLHook*& head = Head(node->ttl_level, node->ttl_slot);
+
+            if(node->ttl_prev != nullptr) {
+                node->ttl_prev->ttl_next = node->ttl_next;
+            } else {
+                head = node->ttl_next;
+            }
+            if(node->ttl_next != nullptr) {
+                node->ttl_next->ttl_prev = node->ttl_prev;
+            }
+
+            if(head == nullptr && node->ttl_level != kFarLevel) {
+                occupied_[node->ttl_level] &= ~(std::uint64_t{1} << node->ttl_slot);
+            }
+        }
+
+        /**
+         * @brief Earliest cursor position at which a slot needs work.
+         *
+         * Level-0 slots at or after the cursor digit expire when reached;
+         * higher-level slots (always ahead of the cursor digit) cascade
+         * when the cursor reaches their start.
+         */
+        bool NextEvent(Timestamp& next) const noexcept {
+            for(std::size_t level = 0; level < kLevels; ++level) {
+                const std::size_t digit = Digit(cursor_, level);
+                const std::size_t first = level == 0 ? digit : digit + 1;
+
+                if(first >= kSlots) {
+                    continue;
+                }
+
+                const std::uint64_t ahead = occupied_[level] & (~std::uint64_t{0} << first);
+                if(ahead == 0) {
+                    continue;
+                }
+
+                const std::size_t shift = (level + 1) * kSlotBits;
+                const Timestamp base = shift >= 64 ? 0 : (cursor_ >> shift) << shift;
+
+                next = base | (static_cast<Timestamp>(__builtin_ctzll(ahead)) << (level * kSlotBits));
+                return true;
+            }
+
+            if(far_ != nullptr) {
+                const Timestamp round = (cursor_ >> kWheelBits) + 1;
+                if(round < (Timestamp{1} << (64 - kWheelBits))) {
+                    next = round << kWheelBits;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Re-links the slots that start at the cursor, top down, so
+         *        their records land in finer slots (or level 0 and expire).
+         */
+        void Cascade() noexcept {
+            for(std::size_t level = kFarLevel; level >= 1; --level) {
+                const Timestamp span_mask = (Timestamp{1} << (level * kSlotBits)) - 1;
+                if((cursor_ & span_mask) != 0) {
+                    continue;
+                }
+
+                TTLHook*& head = Head(level, Digit(cursor_, level));
+                TTLHook* node = head;
+                head = nullptr;
+                if(level != kFarLevel) {
+                    occupied_[level] &= ~(std::uint64_t{1} << Digit(cursor_, level));
+                }
+
+                while(node != nullptr) {
+                    TTLHook* next = node->ttl_next;
+                    Link(node);
+                    node = next;
+                }
+            }
+        }
+
+        std::array<std::array<TTLHook*, kSlots>, kLevels> slots_{};
+        std::array<std::uint64_t, kLevels> occupied_{};
+
+        // Records more than 2^42 ms ahead; re-linked when the top level wraps.
+        TTLHook* far_{nullptr};
+
+        // Wheel time; every record due at or before it has been collected.
+        Timestamp cursor_{0};
+
+        std::size_t size_{0};
+    };
+
     /**
      * @brief TLL index for expiration management.
-     * 
+     *
      *  Maintains : expire_at => set of keys.
-     * 
-     *  Shard is responsibe for actual deletion.
+     *
+     *  Owns a copy of each key; the shard schedules its records on a
+     *  TimingWheel directly instead.
      */
     class TTLIndex final {
         public:
@@ -42,8 +325,8 @@ namespace kvmemo::core {
         TTLIndex(const TTLIndex&) = delete;
         TTLIndex& operator=(const TTLIndex&) = delete;
 
-        TTLIndex(TTLIndex&&) noexcept = default;
-        TTLIndex& operator=(TTLIndex&&) noexcept = default;
+        TTLIndex(TTLIndex&&) = delete;
+        TTLIndex& operator=(TTLIndex&&) = delete;
 
         ~TTLIndex() = default;
 
@@ -52,56 +335,48 @@ namespace kvmemo::core {
          * If key already exists, previous timestamp is removed.
          */
         void Upsert(const Key& key, Timestamp expire_at) {
-            Remove(key);
+            auto it = nodes_.find(key);
+
+            Node* node = nullptr;
+            if(it != nodes_.end()) {
+                node = it->second.get();
+            } else {
+                auto owned = std::make_unique<Node>(key);
+                node = owned.get();
+                nodes_.try_emplace(std::string_view(node->key), std::move(owned));
+            }
 
-            expiry_map_[expire_at].push_back(key);
-            key_index_[key] = expire_at;
+            node->expire_at = expire_at;
+            wheel_.Schedule(node);
         }
 
         /**
          * @brief Remove key from TTL tracking.
          */
         void Remove(const Key& key) {
-            auto it = key_index_.find(key);
-            if(it == key_index_.end()) {
+            auto it = nodes_.find(key);
+            if(it == nodes_.end()) {
                 return;
             }
 
-            Timestamp ts = it->second;
-            auto map_it = expiry_map_.find(ts);
-
-            if(map_it != expiry_map_.end()) {
-                auto& keys = map_it->second;
-            
-                for(auto vec_it = keys.begin(); vec_it != keys.end(); ++vec_it) {
-                    if(*vec_it == key) {
-                        keys.erase(vec_it);
-                        break;
-                    }
-                }
-
-                if(keys.empty()) {
-                    expiry_map_.erase(map_it);
-                }
-            }
-
-            key_index_.erase(it);
+            wheel_.Cancel(it->second.get());
+            nodes_.erase(it);
         }
 
         /**
          * @brief Collect all expired keys up to given timestamps.
+         *
+         * @param limit At most this many keys are returned; keys left over
+         *        are returned by the next call.
          */
-        std::vector<Key> CollectExpired(Timestamp now) {
+        std::vector<Key> CollectExpired(Timestamp now,
+                                        std::size_t limit = std::numeric_limits<std::size_t>::max()) {
             std::vector<Key> expired_keys;
 
-            auto it = expiry_map_.begin();
-            while(it != expiry_map_.end() && it->first <= now) {
-                for(const auto& key : it->second) {
-                    expired_keys.push_back(key);
-                    key_index_.erase(key);
-                }
-
-                it = expiry_map_.erase(it);
+            for(Node* node : wheel_.CollectExpired(now, limit)) {
+                auto it = nodes_.find(node->key);
+                expired_keys.push_back(std::move(node->key));
+                nodes_.erase(it);
             }
 
             return expired_keys;
@@ -111,23 +386,27 @@ namespace kvmemo::core {
          * @brief Returns number of tracked TTL keys.
          */
         std::size_t Size() const noexcept {
-            return key_index_.size();
+            return nodes_.size();
         }
 
         /**
          * @brief Clears entire TTL index.
          */
         void Clear() noexcept {
-            expiry_map_.clear();
-            key_index_.clear();
+            wheel_.Clear();
+            nodes_.clear();
         }
 
         private:
-        // expire_at -> left of keys
-        std::map<Timestamp, std::vector<Key>> expiry_map_;
+        struct Node final : TTLHook {
+            explicit Node(const Key& k) : key(k) {}
+
+            Key key;
+        };
 
-        // key -> expire_at
-        std::unordered_map<Key, Timestamp> key_index_;
+        // key -> node; the view points into the node's own key
+        FlatHashMap<std::string_view, std::unique_ptr<Node>> nodes_;
+        TimingWheel<Node> wheel_;
     };
 } // namespace kvmemo::core
 
@@ -135,4 +414,4 @@ namespace kvmemo::core {
 /**
  * This source code may not be copied, modified, or
  * distributed without explicit permission from the author.
- */
\ No newline at end of file
+ */
@@ -9,73 +9,424 @@
  *  - Consults memory limits
  *  - Selects keys for eviction (via policy)
  *  - Notifies KVEngine when eviction is required
+ *
+ *  Memory limits :
+ *  > Shards report their record allocations straight to the MemoryTracker.
+ *  > Above the tracker's high watermark NeedsEviction() turns true and the
+ *    background Evictor asks for candidates until usage is back under the
+ *    low watermark. Only above the hard limit (MaxLimit) does KVEngine
+ *    evict on the write path or refuse the write.
  * 
+ *  Partitioning :
+ *  > Policy state is split into one partition per shard, each with its own
+ *    policy instance and mutex, so engine operations on different shards
+ *    never share a lock. Policies that keep no per-key state (LRU, none)
+ *    are not called on reads and writes at all.
+ *  > The memory budget is aggregated lock-free by MemoryTracker.
+ *  > Policies that keep per-key state report its size (MemoryUsage());
+ *    after every write, delete and clear the manager charges the change
+ *    to the shard's MemoryTracker partition, so max_memory_bytes bounds
+ *    the policy's copies of the keys as well as the store.
+ *
  *  Thread Safety :
  *  > Thread-Safe
- *  > Internal synchronization for policy tracking
+ *  > Internal synchronization per partition for policy tracking
+ *  > KVEngine holds a partition's lock (Lock()) across a write or delete
+ *    on the shard and the matching hook, so a policy sees a key's writes
+ *    and deletes in the order its shard applied them. Lock order is
+ *    partition, then shard; a shard never calls in here under its lock.
  * 
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <random>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "../common/memory.h"
 #include "../common/status.h"
-#include "../core/lru_cache.h"
+#include "../common/time.h"
+#include "../core/flat_hash_map.h"
+#include "../core/intrusive_lru.h"
+#include "../core/shard_manager.h"
 #include "memory_tracker.h"
 
 namespace kvmemo::eviction {
 /**
  * @brief Abstract eviction policy interface.
+ *
+ * One instance serves one partition: it sees only the keys of its
+ * shard and is called under that partition's lock.
  */
 class EvictionPolicy {
     public:
         virtual ~EvictionPolicy() = default;
 
-        virtual void OnRead(const std::string& key) = 0;
-        virtual void OnWrite(const std::string& key) = 0;
-        virtual void OnDelete(const std::string& key) = 0;
+        virtual void OnRead(std::string_view key) = 0;
+        virtual void OnWrite(std::string_view key) = 0;
+        virtual void OnDelete(std::string_view key) = 0;
         virtual void Clear() = 0;
 
     /**
-     *  @brief Selects candidate key for eviction.
+     *  @brief Selects candidate key for eviction from shard @p shard.
      */
-    virtual std::optional<std::string> SelectVictim() = 0;
+    virtual std::optional<std::string> SelectVictim(const core::ShardManager& shards,
+                                                    std::size_t shard) = 0;
+
+    /**
+     *  @brief False if OnRead/OnWrite/OnDelete are no-ops, so the manager
+     *         can skip them (and their lock) entirely.
+     */
+    virtual bool TracksAccesses() const noexcept {
+        return true;
+    }
+
+    /**
+     *  @brief Whether a write of @p key should be stored while memory is
+     *         above the high watermark. False drops the write, as if the
+     *         key had been stored and evicted straight away.
+     */
+    virtual bool Admit(std::string_view) {
+        return true;
+    }
+
+    /**
+     *  @brief Heap bytes of the policy's per-key state. Read after
+     *         OnWrite/OnDelete/Clear only, so it may only change there.
+     */
+    virtual std::size_t MemoryUsage() const noexcept {
+        return 0;
+    }
 };
 
 /**
  * @brief Default LRU eviction policy implementation
+ *
+ * Every shard already keeps its records in recency order, so the policy
+ * holds no per-key state; it takes the least recently used key of its
+ * shard.
  */
 class LRUPolicy final : public EvictionPolicy {
     public:
-    explicit LRUPolicy(std::unique_ptr<core::LRUCache> lru) : lru_(std::move(lru)) {}
+    void OnRead(std::string_view) override {}
+
+    void OnWrite(std::string_view) override {}
 
-    void OnRead(const std::string& key) override {
-        lru_->Touch(key);
-    } 
+    void OnDelete(std::string_view) override {}
 
-    void OnWrite(const std::string& key) override {
-        lru_->Touch(key);
+    void Clear() override {}
+
+    std::optional<std::string> SelectVictim(const core::ShardManager& shards,
+                                            std::size_t shard) override {
+        return shards.LeastRecentKey(shard);
     }
 
-    void OnDelete(const std::string& key) override {
-        lru_->Remove(key);
+    bool TracksAccesses() const noexcept override {
+        return false;
+    }
+};
+
+/**
+ * @brief Least frequently used eviction (EvictionPolicy::kLFU).
+ *
+ * Keys are grouped into one bucket per access count, and the non-empty
+ * buckets are linked in ascending count order (the O(1) LFU scheme of
+ * Shah, Mitra and Matani). A hit moves its key to the neighbouring
+ * bucket and the victim is the least recently used key of the lowest
+ * bucket, both in constant time.
+ *
+ * Counts are 8-bit and logarithmic, as in Redis: a new key starts at
+ * kInitialCount and a hit increments the count with probability
+ * 1 / ((count - kInitialCount) * log_factor + 1), so 255 takes about a
+ * million hits with the default factor of 10. A key loses one count per
+ * decay period it goes unused. The decay is applied when the key is next
+ * touched, and to a few random keys per victim, so keys that were popular
+ * once and are never read again still fall towards the bottom.
+ *
+ * Keeps a node with a copy of every key of its shard; their bytes are
+ * reported by MemoryUsage() and charged to the memory limit. Expired keys
+ * are dropped through OnDelete like deleted ones.
+ */
+class LFUPolicy final : public EvictionPolicy {
+    public:
+    static constexpr std::uint32_t kDefaultLogFactor = 10;
+    static constexpr std::uint64_t kDefaultDecayMs = 60'000;
+
+    /**
+     * @brief Count of a new key, so it is not the next victim right away.
+     */
+    static constexpr std::uint8_t kInitialCount = 5;
+
+    /**
+     * @brief Random keys decayed per SelectVictim().
+     */
+    static constexpr std::size_t kDecaySamples = 4;
+
+    /**
+     * @param log_factor How slowly counts grow (0: every hit counts).
+     * @param decay_ms   Idle time that costs one count (0: no decay).
+     */
+    explicit LFUPolicy(std::uint32_t log_factor = kDefaultLogFactor,
+                       std::uint64_t decay_ms = kDefaultDecayMs)
+        : log_factor_(log_factor), decay_ms_(decay_ms) {
+        head_.lower = &head_;
+        head_.higher = &head_;
+        for(std::size_t count = 0; count < buckets_.size(); ++count) {
+            buckets_[count].count = static_cast<std::uint8_t>(count);
+        }
+    }
+
+    LFUPolicy(const LFUPolicy&) = delete;
+    LFUPolicy& operator=(const LFUPolicy&) = delete;
+
+    void OnRead(std::string_view key) override {
+        auto it = nodes_.find(key);
+        if(it != nodes_.end()) {
+            Touch(it->second.get());
+        }
+    }
+
+    void OnWrite(std::string_view key) override {
+        auto it = nodes_.find(key);
+        if(it != nodes_.end()) {
+            Touch(it->second.get());
+            return;
+        }
+
+        auto node = std::make_unique<Node>();
+        node->key = std::string(key);
+        node->touched_at = common::CoarseClock::Now();
+        node->count = kInitialCount;
+
+        Node* added = node.get();
+        nodes_.try_emplace(std::string_view(added->key), std::move(node));
+        node_bytes_ += NodeBytes(*added);
+        Place(added, &head_);
+    }
+
+    void OnDelete(std::string_view key) override {
+        auto it = nodes_.find(key);
+        if(it == nodes_.end()) {
+            return;
+        }
+
+        Unplace(it->second.get());
+        node_bytes_ -= NodeBytes(*it->second);
+        nodes_.erase(it);
     }
 
     void Clear() override {
-        lru_->Clear();
+        for(auto& bucket : buckets_) {
+            bucket.nodes.Clear();
+            bucket.lower = nullptr;
+            bucket.higher = nullptr;
+        }
+        head_.lower = &head_;
+        head_.higher = &head_;
+        nodes_.clear();
+        node_bytes_ = 0;
     }
 
-    std::optional<std::string> SelectVictim() override {
-        return lru_->PopEvictionCandidate();
+    std::size_t MemoryUsage() const noexcept override {
+        return node_bytes_ + nodes_.allocated_bytes();
     }
 
-private:
-    std::unique_ptr<core::LRUCache> lru_;
+    std::optional<std::string> SelectVictim(const core::ShardManager&, std::size_t) override {
+        if(nodes_.empty()) {
+            return std::nullopt;
+        }
+
+        if(decay_ms_ > 0) {
+            const common::EpochMillis now = common::CoarseClock::Now();
+            auto it = nodes_.from_slot(rng_() % nodes_.capacity());
+            for(std::size_t i = 0; i < kDecaySamples && i < nodes_.size(); ++i, ++it) {
+                if(it == nodes_.end()) {
+                    it = nodes_.from_slot(0);
+                }
+                Decay(it->second.get(), now);
+            }
+        }
+
+        return head_.higher->nodes.Back()->key;
+    }
+
+    /**
+     * @brief Keys currently tracked.
+     */
+    std::size_t Size() const noexcept {
+        return nodes_.size();
+    }
+
+    /**
+     * @brief Current count of @p key, if tracked.
+     */
+    std::optional<std::uint8_t> Count(std::string_view key) const {
+        auto it = nodes_.find(key);
+        if(it == nodes_.end()) {
+            return std::nullopt;
+        }
+        return it->second->count;
+    }
+
+    private:
+    struct Node : core::LRUHook {
+        std::string key;
+        common::EpochMillis touched_at{0};
+        std::uint8_t count{0};
+    };
+
+    // Linked into the count-ordered list only while it holds keys.
+    struct Bucket {
+        Bucket* lower{nullptr};
+        Bucket* higher{nullptr};
+        std::uint8_t count{0};
+        core::IntrusiveLRU<Node> nodes;
+    };
+
+    static std::size_t NodeBytes(const Node& node) noexcept {
+        return common::AllocatedBytes(sizeof(Node)) + common::HeapBytes(node.key);
+    }
+
+    void Touch(Node* node) {
+        const common::EpochMillis now = common::CoarseClock::Now();
+        std::uint8_t count = Decayed(node, now);
+
+        if(count < 255) {
+            const double base = count > kInitialCount ? count - kInitialCount : 0;
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            if(uniform(rng_) < 1.0 / (base * log_factor_ + 1)) {
+                ++count;
+            }
+        }
+
+        node->touched_at = now;
+        Move(node, count);
+    }
+
+    // The node's count after the decay periods it has been idle for.
+    std::uint8_t Decayed(const Node* node, common::EpochMillis now) const noexcept {
+        if(decay_ms_ == 0 || now <= node->touched_at) {
+            return node->count;
+        }
+
+        const std::uint64_t periods = (now - node->touched_at) / decay_ms_;
+        return periods >= node->count ? 0 : static_cast<std::uint8_t>(node->count - periods);
+    }
+
+    void Decay(Node* node, common::EpochMillis now) {
+        const std::uint8_t count = Decayed(node, now);
+        if(count == node->count) {
+            return;
+        }
+
+        // Only whole periods are charged; the remainder still counts.
+        node->touched_at += static_cast<common::EpochMillis>(node->count - count) * decay_ms_;
+        Move(node, count);
+    }
+
+    void Move(Node* node, std::uint8_t count) {
+        Bucket* from = &buckets_[node->count];
+        if(count == node->count) {
+            from->nodes.MoveToFront(node);
+            return;
+        }
+
+        // Link the new bucket while the old one still marks the position.
+        node->count = count;
+        from->nodes.Remove(node);
+        Place(node, from);
+        if(from->nodes.Empty()) {
+            Unlink(from);
+        }
+    }
+
+    /**
+     * @brief Adds @p node to the bucket of its count, linking that bucket
+     *        next to @p near (a linked bucket or head_) if it was empty.
+     *        Walks at most the buckets between the two counts.
+     */
+    void Place(Node* node, Bucket* near) {
+        Bucket* bucket = &buckets_[node->count];
+        if(bucket->nodes.Empty()) {
+            if(near == &head_ || near->count < bucket->count) {
+                while(near->higher != &head_ && near->higher->count < bucket->count) {
+                    near = near->higher;
+                }
+                LinkAfter(near, bucket);
+            }
+            else {
+                while(near->lower != &head_ && near->lower->count > bucket->count) {
+                    near = near->lower;
+                }
+                LinkAfter(near->lower, bucket);
+            }
+        }
+        bucket->nodes.PushFront(node);
+    }
+
+    void Unplace(Node* node) {
+        Bucket* bucket = &buckets_[node->count];
+        bucket->nodes.Remove(node);
+        if(bucket->nodes.Empty()) {
+            Unlink(bucket);
+        }
+    }
+
+    static void LinkAfter(Bucket* pos, Bucket* bucket) noexcept {
+        bucket->lower = pos;
+        bucket->higher = pos->higher;
+        pos->higher->lower = bucket;
+        pos->higher = bucket;
+    }
+
+    static void Unlink(Bucket* bucket) noexcept {
+        bucket->lower->higher = bucket->higher;
+        bucket->higher->lower = bucket->lower;
+        bucket->lower = nullptr;
+        bucket->higher = nullptr;
+    }
+
+    const std::uint32_t log_factor_;
+    const std::uint64_t decay_ms_;
+
+    core::FlatHashMap<std::string_view, std::unique_ptr<Node>> nodes_;
+    std::size_t node_bytes_{0};
+    std::array<Bucket, 256> buckets_;
+    Bucket head_; // sentinel: higher is the lowest count, lower the highest
+    std::minstd_rand rng_;
+};
+
+/**
+ * @brief Policy that never selects a victim (EvictionPolicy::kNone):
+ *        writes are refused at the hard limit instead.
+ */
+class NoEvictionPolicy final : public EvictionPolicy {
+    public:
+    void OnRead(std::string_view) override {}
+
+    void OnWrite(std::string_view) override {}
+
+    void OnDelete(std::string_view) override {}
+
+    void Clear() override {}
+
+    std::optional<std::string> SelectVictim(const core::ShardManager&, std::size_t) override {
+        return std::nullopt;
+    }
+
+    bool TracksAccesses() const noexcept override {
+        return false;
+    }
 };
 
 /**
@@ -83,88 +434,267 @@ private:
  */
 class EvictionManager {
     public: 
+    /**
+     * @brief Creates one policy per partition.
+     */
+    using PolicyFactory = std::function<std::unique_ptr<EvictionPolicy>()>;
+
+    /**
+     * @param partitions Number of policy partitions; shard i uses
+     *        partition i % partitions. Pass the shard count.
+     */
     EvictionManager(std::unique_ptr<MemoryTracker> memory_tracker, 
-                 std::unique_ptr<EvictionPolicy> policy)
+                 const PolicyFactory& make_policy,
+                 std::size_t partitions = 1)
                  : memory_tracker_(std::move(memory_tracker)),
-                 policy_(std::move(policy)) {}
+                 partitions_(partitions == 0 ? 1 : partitions) {
+        for(auto& partition : partitions_) {
+            partition.policy = make_policy();
+        }
+        tracks_accesses_ = partitions_.front().policy->TracksAccesses();
+    }
 
     EvictionManager(const EvictionManager&) = delete;
     EvictionManager& operator=(const EvictionManager&) = delete;
     ~EvictionManager() = default;
 
     /**
-     * @brief Called when a key is read.
+     * @brief Proof that a shard's partition is locked; see Lock().
+     */
+    using PartitionLock = std::unique_lock<std::mutex>;
+
+    /**
+     * @brief Locks shard @p shard's partition so that a change to the
+     *        shard's store and the matching hook reach the policy as one
+     *        step, in the order the shard applied them. Shard locks may be
+     *        taken while it is held. Returns an empty lock if the policy
+     *        tracks no accesses.
      */
-    void OnRead(const std::string& key) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        policy_->OnRead(key);
+    PartitionLock Lock(std::size_t shard) {
+        if(!tracks_accesses_) {
+            return PartitionLock();
+        }
+        return PartitionLock(PartitionOf(shard).mutex);
+    }
+
+    /**
+     * @brief Called when a key of shard @p shard is read.
+     */
+    void OnRead(std::size_t shard, std::string_view key) {
+        if(!tracks_accesses_) {
+            return;
+        }
+
+        Partition& partition = PartitionOf(shard);
+        std::lock_guard<std::mutex> lock(partition.mutex);
+        partition.policy->OnRead(key);
+    }
+
+    /**
+     * @brief Called when a key of shard @p shard is written.
+     */
+    void OnWrite(std::size_t shard, std::string_view key) {
+        const PartitionLock lock = Lock(shard);
+        OnWrite(lock, shard, key);
+    }
+
+    /**
+     * @brief OnWrite() under a Lock(shard) the caller already holds.
+     */
+    void OnWrite(const PartitionLock& lock, std::size_t shard, std::string_view key) {
+        if(!lock.owns_lock()) {
+            return;
+        }
+
+        Partition& partition = PartitionOf(shard);
+        partition.policy->OnWrite(key);
+        Charge(partition);
+    }
+
+    /**
+     * @brief Called when a key of shard @p shard is deleted.
+     */
+    void OnDelete(std::size_t shard, std::string_view key) {
+        const PartitionLock lock = Lock(shard);
+        OnDelete(lock, shard, key);
     }
 
     /**
-     * @brief Called when a key is written.
-     * May trigger eviction if memory exceeded.
+     * @brief OnDelete() under a Lock(shard) the caller already holds.
      */
-    void OnWrite(const std::string& key) {
-        std::lock_guard<std::mutex> lock(mutex_);
+    void OnDelete(const PartitionLock& lock, std::size_t shard, std::string_view key) {
+        if(!lock.owns_lock()) {
+            return;
+        }
 
-        memory_tracker_->Reserve(100);
-        policy_->OnWrite(key);
+        Partition& partition = PartitionOf(shard);
+        partition.policy->OnDelete(key);
+        Charge(partition);
+    }
 
-        EnforceMemoryLimit();
+    /**
+     * @brief Asks shard @p shard's policy whether to store a write of
+     *        @p key under memory pressure (EvictionPolicy::Admit).
+     */
+    bool Admit(std::size_t shard, std::string_view key) {
+        const PartitionLock lock = Lock(shard);
+        return Admit(lock, shard, key);
     }
 
     /**
-     * @brief Called when a key is deleted.
+     * @brief Admit() under a Lock(shard) the caller already holds.
      */
-    void OnDelete(const std::string& key) {
-        std::lock_guard<std::mutex> lock(mutex_);
+    bool Admit(const PartitionLock& lock, std::size_t shard, std::string_view key) {
+        if(!lock.owns_lock()) {
+            return true;
+        }
+        return PartitionOf(shard).policy->Admit(key);
+    }
 
-        memory_tracker_->Release(100);
-        policy_->OnDelete(key);
-    } 
+    /**
+     * @brief Whether OnRead/OnWrite/OnDelete do anything; callers may skip
+     *        looking up the key's shard when they do not.
+     */
+    bool TracksAccesses() const noexcept {
+        return tracks_accesses_;
+    }
 
     /**
-     * @brief Resets eviction state: clears policy tracking and memory counter.
-     * Called on FLUSH.
+     * @brief Resets eviction state: clears policy tracking.
+     * Called on FLUSH; the shards release their own memory.
      */
     void Clear() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        policy_->Clear();
-        memory_tracker_->Reset();
+        Clear([] {});
+    }
+
+    /**
+     * @brief Runs @p clear_store, which empties the shards, and clears
+     *        every policy while all partitions are locked, so no write can
+     *        land between the two and be forgotten by its policy.
+     */
+    template <typename ClearStore>
+    void Clear(ClearStore&& clear_store) {
+        std::vector<PartitionLock> locks;
+        locks.reserve(partitions_.size());
+        for(auto& partition : partitions_) {
+            locks.emplace_back(partition.mutex);
+        }
+
+        clear_store();
+        for(auto& partition : partitions_) {
+            partition.policy->Clear();
+            Charge(partition);
+        }
+    }
+
+    /**
+     * @brief Bytes of per-key policy state currently charged to the
+     *        tracker, over all partitions.
+     */
+    std::size_t PolicyMemoryUsage() const noexcept {
+        std::size_t total = 0;
+        for(const auto& partition : partitions_) {
+            total += partition.charged.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief The tracker shards report their allocations to.
+     */
+    MemoryTracker& Memory() noexcept {
+        return *memory_tracker_;
+    }
+
+    const MemoryTracker& Memory() const noexcept {
+        return *memory_tracker_;
     }
 
     /**
-     * @brief Returns keys that must be evicted.
+     * @brief Returns true once usage is above the high watermark.
      */
-    std::vector<std::string> CollectEvictionCandidates() {
-        std::lock_guard<std::mutex> lock(mutex_);
+    bool NeedsEviction() const noexcept {
+        return memory_tracker_->IsAboveHighWatermark();
+    }
+
+    /**
+     * @brief Returns true once usage is above the hard limit.
+     */
+    bool IsOverHardLimit() const noexcept {
+        return memory_tracker_->IsOverLimit();
+    }
+
+    /**
+     * @brief Returns the next key to evict, or nullopt once memory is back
+     *        under the low watermark. Shards are visited round-robin. The
+     *        caller deletes it before asking again.
+     */
+    std::optional<std::string> NextEvictionCandidate(const core::ShardManager& shards) {
+        const std::size_t count = shards.ShardCount();
 
-        std::vector<std::string> victims;
+        for(std::size_t i = 0; i < count; ++i) {
+            if(!memory_tracker_->IsAboveLowWatermark()) {
+                return std::nullopt;
+            }
 
-        while(memory_tracker_->IsOverLimit()) {
-            auto candidate = policy_->SelectVictim();
+            const std::size_t shard = next_shard_.fetch_add(1, std::memory_order_relaxed) % count;
+            Partition& partition = PartitionOf(shard);
 
-            if(!candidate.has_value()) {
-                break;
+            std::optional<std::string> victim;
+            {
+                std::lock_guard<std::mutex> lock(partition.mutex);
+                victim = partition.policy->SelectVictim(shards, shard);
             }
 
-            victims.push_back(candidate.value());
-            memory_tracker_->Release(100);
+            if(victim.has_value()) {
+                return victim;
+            }
         }
-
-        return victims;
+        return std::nullopt;
     }
 
     private:
-        void EnforceMemoryLimit() {
-            if(!memory_tracker_->IsOverLimit()) {
-                return;
-            }
+    /**
+     * @brief One partition's policy and its lock, on its own cache line.
+     */
+    struct alignas(64) Partition {
+        std::mutex mutex;
+        std::unique_ptr<EvictionPolicy> policy;
+        // policy->MemoryUsage() as last charged; written under mutex.
+        std::atomic<std::size_t> charged{0};
+    };
+
+    Partition& PartitionOf(std::size_t shard) noexcept {
+        return partitions_[shard % partitions_.size()];
+    }
+
+    /**
+     * @brief Charges the change in the policy's size to the tracker
+     *        partition with the same index. Called under partition.mutex.
+     */
+    void Charge(Partition& partition) noexcept {
+        const auto index = static_cast<std::size_t>(&partition - partitions_.data());
+        const std::size_t usage = partition.policy->MemoryUsage();
+        const std::size_t charged = partition.charged.load(std::memory_order_relaxed);
+        if(usage == charged) {
+            return;
+        }
+
+        if(usage > charged) {
+            memory_tracker_->Reserve(index, usage - charged);
         }
+        else {
+            memory_tracker_->Release(index, charged - usage);
+        }
+        partition.charged.store(usage, std::memory_order_relaxed);
+    }
 
     std::unique_ptr<MemoryTracker> memory_tracker_;
-    std::unique_ptr<EvictionPolicy> policy_;
-    std::mutex mutex_;
+    std::vector<Partition> partitions_;
+    bool tracks_accesses_{false};
+
+    // Shard the next eviction candidate is taken from.
+    std::atomic<std::size_t> next_shard_{0};
 };
 } // namespace kvmemo::eviction
 /**
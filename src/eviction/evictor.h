@@ -0,0 +1,162 @@
+#pragma once
+/**
+ * @file evictor.h
+ * @brief Background eviction driven by MemoryTracker watermarks.
+ *
+ * Responsibility :
+ *  Evictor keeps memory under the configured limit without putting
+ *  eviction on the request path.
+ *
+ *  IT :
+ *  - Checks memory usage every Config::eviction_interval_ms.
+ *  - Once usage is above the high watermark, evicts keys chosen by the
+ *    eviction policy, one batch at a time, until usage is back under the
+ *    low watermark.
+ *
+ *  IT DOES NOT :
+ *  - Choose victims (EvictionPolicy does).
+ *  - Refuse writes; KVEngine does that above the hard limit, which the
+ *    gap between the watermarks keeps writers away from.
+ *
+ *  Thread Safety :
+ *  > Thread-Safe assuming underlying components are thread-safe.
+ *  > RunCycle() must not be called concurrently with itself.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#include "../core/kv_engine.h"
+
+namespace kvmemo::eviction {
+
+    class Evictor final {
+        public:
+        /**
+         * @brief Constructs Evictor.
+         *
+         * @param engine Engine whose keys are evicted.
+         * @param interval Pause between usage checks (Config::eviction_interval_ms).
+         */
+        Evictor(core::KVEngine& engine, std::chrono::milliseconds interval)
+            : engine_(engine),
+              interval_(interval) {}
+
+        Evictor(const Evictor&) = delete;
+        Evictor& operator=(const Evictor&) = delete;
+
+        Evictor(Evictor&&) = delete;
+        Evictor& operator=(Evictor&&) = delete;
+
+        ~Evictor() {
+            Stop();
+        }
+
+        /**
+         * @brief Starts the background thread; no-op if already running.
+         */
+        void Start() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(thread_.joinable()) {
+                return;
+            }
+
+            stop_ = false;
+            thread_ = std::thread([this] { Loop(); });
+        }
+
+        /**
+         * @brief Stops and joins the background thread.
+         */
+        void Stop() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_one();
+
+            if(thread_.joinable()) {
+                thread_.join();
+            }
+        }
+
+        /**
+         * @brief Runs one eviction cycle.
+         *
+         * - Frees lock-free shards' retired records first, since they
+         *   count towards usage until then.
+         * - Evicts nothing unless usage is above the high watermark.
+         * - Otherwise evicts in batches of KVEngine::kEvictionBatch until
+         *   usage is under the low watermark or the policy has no victim.
+         *
+         * @return Number of keys evicted.
+         */
+        std::size_t RunCycle() {
+            engine_.ReclaimRetired();
+
+            if(!engine_.NeedsEviction()) {
+                return 0;
+            }
+
+            std::size_t evicted = 0;
+            for(;;) {
+                const std::size_t batch = engine_.Evict(core::KVEngine::kEvictionBatch);
+                evicted += batch;
+
+                if(batch < core::KVEngine::kEvictionBatch || StopRequested()) {
+                    break;
+                }
+            }
+
+            total_evicted_.fetch_add(evicted, std::memory_order_relaxed);
+            return evicted;
+        }
+
+        /**
+         * @brief Keys evicted by this evictor since construction.
+         */
+        std::size_t TotalEvicted() const noexcept {
+            return total_evicted_.load(std::memory_order_relaxed);
+        }
+
+        private:
+        void Loop() {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            while(!stop_) {
+                lock.unlock();
+                RunCycle();
+                lock.lock();
+
+                cv_.wait_for(lock, interval_, [this] { return stop_; });
+            }
+        }
+
+        bool StopRequested() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return stop_;
+        }
+
+        core::KVEngine& engine_;
+        const std::chrono::milliseconds interval_;
+
+        std::atomic<std::size_t> total_evicted_{0};
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_{false};
+        std::thread thread_;
+    };
+} // namespace kvmemo::eviction
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -0,0 +1,179 @@
+#pragma once
+/**
+ * @file frequency_sketch.h
+ * @brief Count-min sketch of recent key popularity for TinyLFU.
+ *
+ *  Responsibilities :
+ *  - Estimate how often a key was accessed recently in O(1) and a few
+ *    bytes per tracked key, including keys that are not resident.
+ *  - Age the counts so popularity that has faded stops protecting a key.
+ *
+ *  Design (after Caffeine's FrequencySketch) :
+ *  > 4-bit saturating counters, sixteen to a 64-bit word. A key maps to
+ *    one counter in each of four words chosen by independent hashes, and
+ *    its estimate is the smallest of the four.
+ *  > After kSampleFactor increments per word every counter is halved, so
+ *    the sketch reflects a sliding window of recent accesses.
+ *  > The table is sized to the number of tracked keys (EnsureCapacity);
+ *    growing it starts the counts afresh.
+ *
+ *  Thread Safety :
+ *  > Not thread-safe; the owning policy is called under its partition lock.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../common/memory.h"
+
+namespace kvmemo::eviction {
+
+    class FrequencySketch final {
+        public:
+        /**
+         * @brief Largest estimate; counters saturate here.
+         */
+        static constexpr std::uint32_t kMaxFrequency = 15;
+
+        /**
+         * @brief Increments per table word before all counts are halved.
+         */
+        static constexpr std::size_t kSampleFactor = 10;
+
+        explicit FrequencySketch(std::size_t capacity = 0) {
+            EnsureCapacity(capacity);
+        }
+
+        /**
+         * @brief Grows the table to suit @p capacity keys. Growing
+         *        discards the current counts.
+         */
+        void EnsureCapacity(std::size_t capacity) {
+            std::size_t words = kMinWords;
+            while(words < capacity) {
+                words <<= 1;
+            }
+
+            if(words > table_.size()) {
+                table_.assign(words, 0);
+                additions_ = 0;
+            }
+        }
+
+        /**
+         * @brief Records one access of the key with hash @p hash.
+         */
+        void Increment(std::size_t hash) noexcept {
+            const std::uint64_t spread = Spread(hash);
+            const std::size_t start = static_cast<std::size_t>(spread & 3) << 2;
+
+            bool added = false;
+            for(std::size_t i = 0; i < kDepth; ++i) {
+                added |= IncrementAt(IndexOf(spread, i), start + i);
+            }
+
+            if(added && ++additions_ >= table_.size() * kSampleFactor) {
+                Age();
+            }
+        }
+
+        /**
+         * @brief Estimated recent accesses of the key with hash @p hash,
+         *        at most kMaxFrequency.
+         */
+        std::uint32_t Frequency(std::size_t hash) const noexcept {
+            const std::uint64_t spread = Spread(hash);
+            const std::size_t start = static_cast<std::size_t>(spread & 3) << 2;
+
+            std::uint32_t frequency = kMaxFrequency;
+            for(std::size_t i = 0; i < kDepth; ++i) {
+                const std::uint32_t count = CounterAt(IndexOf(spread, i), start + i);
+                frequency = count < frequency ? count : frequency;
+            }
+            return frequency;
+        }
+
+        /**
+         * @brief Forgets every count.
+         */
+        void Clear() noexcept {
+            for(auto& word : table_) {
+                word = 0;
+            }
+            additions_ = 0;
+        }
+
+        /**
+         * @brief Number of 64-bit words in the table.
+         */
+        std::size_t Words() const noexcept {
+            return table_.size();
+        }
+
+        /**
+         * @brief Heap bytes of the table, as allocated.
+         */
+        std::size_t AllocatedBytes() const noexcept {
+            return common::AllocatedBytes(table_.size() * sizeof(std::uint64_t));
+        }
+
+        private:
+        static constexpr std::size_t kDepth = 4;
+        static constexpr std::size_t kMinWords = 64;
+        static constexpr std::uint64_t kResetMask = 0x7777777777777777ULL;
+
+        static constexpr std::uint64_t kSeeds[kDepth] = {
+            0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+            0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+
+        // std::hash of a string is good, but of an integer it is the
+        // identity; mix so nearby hashes use unrelated counters.
+        static std::uint64_t Spread(std::size_t hash) noexcept {
+            std::uint64_t x = static_cast<std::uint64_t>(hash);
+            x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+            x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+            return x ^ (x >> 33);
+        }
+
+        std::size_t IndexOf(std::uint64_t spread, std::size_t row) const noexcept {
+            std::uint64_t h = (spread + kSeeds[row]) * kSeeds[row];
+            h += h >> 32;
+            return static_cast<std::size_t>(h) & (table_.size() - 1);
+        }
+
+        // Counter @p counter (0-15) of word @p index.
+        std::uint32_t CounterAt(std::size_t index, std::size_t counter) const noexcept {
+            return static_cast<std::uint32_t>((table_[index] >> (counter << 2)) & 0xF);
+        }
+
+        bool IncrementAt(std::size_t index, std::size_t counter) noexcept {
+            const std::size_t shift = counter << 2;
+            if(((table_[index] >> shift) & 0xF) == kMaxFrequency) {
+                return false;
+            }
+
+            table_[index] += std::uint64_t{1} << shift;
+            return true;
+        }
+
+        // Halves every counter.
+        void Age() noexcept {
+            for(auto& word : table_) {
+                word = (word >> 1) & kResetMask;
+            }
+            additions_ /= 2;
+        }
+
+        std::vector<std::uint64_t> table_;
+        std::size_t additions_{0};
+    };
+} // namespace kvmemo::eviction
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -1,49 +1,89 @@
 #pragma once 
 /**
  * @file memory_tracker.h
- * @brief Track approximate memory usage of the KV Engine.
+ * @brief Track memory usage of the KV Engine.
  * 
  * Responsibilities : 
  *  - Track current memory consumption.
  *  - Enforce memory limits.
  *  - Provide atomic updates for concurrent environment.
+ *
+ * Limits :
+ *  > High watermark : background eviction starts above it.
+ *  > Low watermark  : background eviction stops once usage is back under it.
+ *  > Max limit      : the hard limit; writes are refused above it.
+ * 
+ * Aggregation :
+ *  > Usage is kept in per-partition counters (one per shard), each on its
+ *    own cache line, so concurrent writers to different shards never
+ *    update the same word.
+ *  > The limit checks read a single aggregate. A partition adds its change
+ *    to the aggregate only once it has drifted by a fixed step from what
+ *    it last added, which bounds the aggregate's error to
+ *    MaxLimit() / kFoldFraction (0.4%) while the shared counter is
+ *    written once per step rather than on every write.
  * 
  * Thread Safety :
- *  - Fully Thread safe via atomic counters. 
+ *  - Fully Thread safe via atomic counters; no locks.
  * 
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 
 namespace kvmemo::eviction {
     /**
-     * @brief Track approximate memory usage of the system.
+     * @brief Track memory usage of the system.
      * 
      * This tracker does not peform deep objects introspection.
-     * It relies on upper layers(Shard, Entry) to report memory deltas.
+     * It relies on upper layers(Shard) to report memory deltas.
      * 
-     *  Memory Accounting Model : 
+     *  Memory Accounting Model (see common::MemoryUsage) : 
      *  - Value Size
      *  - Key Size
-     *  - Metadata overhead
+     *  - Metadata overhead, including allocator size-class rounding
+     *    and index tables
      */
     class MemoryTracker final {
         public: 
         /**
          * @brief Construct MemoryTracker
          * @param max_memory_bytes Maximum allowed memory
+         * @param high_watermark_percent Share of the maximum above which
+         *        background eviction starts.
+         * @param low_watermark_percent Share of the maximum background
+         *        eviction brings usage back down to.
+         * @param partitions Number of usage counters; one per shard lets
+         *        every shard update its own.
          */
-        explicit MemoryTracker(std::size_t max_memory_bytes)
+        explicit MemoryTracker(std::size_t max_memory_bytes,
+                               std::size_t high_watermark_percent = 90,
+                               std::size_t low_watermark_percent = 80,
+                               std::size_t partitions = 1)
             : max_memory_bytes_(max_memory_bytes),
-            current_memory_bytes_(0)
+            high_watermark_bytes_(max_memory_bytes / 100 * high_watermark_percent),
+            low_watermark_bytes_(max_memory_bytes / 100 * low_watermark_percent),
+            partition_count_(partitions),
+            fold_bytes_(std::max<std::size_t>(1, max_memory_bytes / (std::max<std::size_t>(1, partitions) * kFoldFraction))),
+            partitions_(partitions == 0 ? nullptr : new Partition[partitions])
         {
             if(max_memory_bytes_ == 0) {
                 throw std::invalid_argument("Max memory must be greater than zero");
             }
+
+            if(low_watermark_percent == 0 || low_watermark_percent >= high_watermark_percent ||
+               high_watermark_percent > 100) {
+                throw std::invalid_argument("Watermarks must satisfy 0 < low < high <= 100");
+            }
+
+            if(partition_count_ == 0) {
+                throw std::invalid_argument("Memory tracker needs at least one partition");
+            }
         }
 
         MemoryTracker(const MemoryTracker&) = delete;
@@ -61,7 +101,7 @@ namespace kvmemo::eviction {
          * @return true if within limit after reservation.
          */
         bool Reserve(std::size_t bytes) noexcept {
-            current_memory_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+            Reserve(0, bytes);
             return !IsOverLimit();
         }
 
@@ -70,14 +110,53 @@ namespace kvmemo::eviction {
          * @param bytes Number of bytes to subtract.
          */
         void Release(std::size_t bytes) noexcept {
-            current_memory_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+            Release(0, bytes);
+        }
+
+        /**
+         * @brief Adds @p bytes to partition @p partition (taken modulo the
+         *        partition count).
+         */
+        void Reserve(std::size_t partition, std::size_t bytes) noexcept {
+            Apply(partition, bytes);
+        }
+
+        /**
+         * @brief Subtracts @p bytes from partition @p partition.
+         */
+        void Release(std::size_t partition, std::size_t bytes) noexcept {
+            Apply(partition, std::size_t{0} - bytes);
         }
 
         /**
-         * @brief Returns current memory usage.
+         * @brief Returns current memory usage: the exact sum of every
+         *        partition.
          */
         std::size_t CurrentUsage() const noexcept {
-            return current_memory_bytes_.load(std::memory_order_relaxed);
+            std::size_t total = 0;
+            for(std::size_t i = 0; i < partition_count_; ++i) {
+                total += partitions_[i].usage.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /**
+         * @brief Returns the usage of one partition.
+         */
+        std::size_t PartitionUsage(std::size_t partition) const noexcept {
+            return partitions_[partition % partition_count_].usage.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Returns the usage the limit checks see: one load, within
+         *        MaxLimit() / kFoldFraction of CurrentUsage().
+         */
+        std::size_t AggregateUsage() const noexcept {
+            return aggregate_bytes_.load(std::memory_order_relaxed);
+        }
+
+        std::size_t PartitionCount() const noexcept {
+            return partition_count_;
         }
 
         /**
@@ -91,19 +170,88 @@ namespace kvmemo::eviction {
          * @brief Returns true if memory exceeds configured limits.
          */
         bool IsOverLimit() const noexcept {
-            return CurrentUsage() > max_memory_bytes_;
+            return AggregateUsage() > max_memory_bytes_;
+        }
+
+        std::size_t HighWatermark() const noexcept {
+            return high_watermark_bytes_;
+        }
+
+        std::size_t LowWatermark() const noexcept {
+            return low_watermark_bytes_;
+        }
+
+        /**
+         * @brief Returns true if background eviction should start.
+         */
+        bool IsAboveHighWatermark() const noexcept {
+            return AggregateUsage() > high_watermark_bytes_;
+        }
+
+        /**
+         * @brief Returns true while background eviction should continue.
+         */
+        bool IsAboveLowWatermark() const noexcept {
+            return AggregateUsage() > low_watermark_bytes_;
         }
 
         /**
          * @brief Resets memory usage counter to zero.
          */
         void Reset() noexcept {
-            current_memory_bytes_.store(0, std::memory_order_relaxed);
+            for(std::size_t i = 0; i < partition_count_; ++i) {
+                partitions_[i].usage.store(0, std::memory_order_relaxed);
+                partitions_[i].folded.store(0, std::memory_order_relaxed);
+            }
+            aggregate_bytes_.store(0, std::memory_order_relaxed);
         }
 
+        /**
+         * @brief A partition's drift from the aggregate is folded in once
+         *        it reaches MaxLimit() / (partitions * kFoldFraction), so
+         *        the aggregate is never off by more than
+         *        MaxLimit() / kFoldFraction.
+         */
+        static constexpr std::size_t kFoldFraction = 256;
+
     private:
+        /**
+         * @brief One partition's exact usage and the part of it already
+         *        added to aggregate_bytes_. On its own cache line, so
+         *        shards updating different partitions do not contend.
+         */
+        struct alignas(64) Partition {
+            std::atomic<std::size_t> usage{0};
+            std::atomic<std::size_t> folded{0};
+        };
+
+        /**
+         * @brief Adds @p delta (wrapping, so a release is a negative delta)
+         *        to a partition, and folds its drift into the aggregate
+         *        when it has grown past fold_bytes_ either way.
+         */
+        void Apply(std::size_t partition, std::size_t delta) noexcept {
+            Partition& p = partitions_[partition % partition_count_];
+
+            const std::size_t usage = p.usage.fetch_add(delta, std::memory_order_relaxed) + delta;
+            const std::size_t drift = usage - p.folded.load(std::memory_order_relaxed);
+
+            if(std::min(drift, std::size_t{0} - drift) >= fold_bytes_) {
+                const std::size_t folded = p.folded.exchange(usage, std::memory_order_relaxed);
+                aggregate_bytes_.fetch_add(usage - folded, std::memory_order_relaxed);
+            }
+        }
+
         const std::size_t max_memory_bytes_;
-        std::atomic<std::size_t> current_memory_bytes_;
+        const std::size_t high_watermark_bytes_;
+        const std::size_t low_watermark_bytes_;
+
+        const std::size_t partition_count_;
+        const std::size_t fold_bytes_;
+        std::unique_ptr<Partition[]> partitions_;
+
+        // Sum of every partition's folded usage.
+        alignas(64) std::atomic<std::size_t> aggregate_bytes_{0};
     };
 } // namespace kvmemo::eviction
 
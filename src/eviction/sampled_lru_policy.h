@@ -0,0 +1,146 @@
+#pragma once
+/**
+ * @file sampled_lru_policy.h
+ * @brief Approximate LRU eviction by sampling record access clocks.
+ *
+ *  Responsibilities :
+ *  - Pick eviction victims close to exact LRU order without keeping any
+ *    recency list up to date on reads (EvictionPolicy::kSampledLRU, after
+ *    Redis's allkeys-lru).
+ *
+ *  Algorithm :
+ *  > Shards run with AccessTracking::kSampled, so a GET hit only stamps
+ *    the record's 24-bit access clock.
+ *  > Each SelectVictim() samples a few records of the shard (Config::
+ *    eviction_samples) from a random index slot and offers them to a pool
+ *    of the kPoolSize most idle keys seen so far. The most idle pool entry
+ *    is the victim, unless it was deleted or used again since it was
+ *    sampled, in which case it is dropped and the next one is tried.
+ *  > The pool carries good candidates across calls, so with 5 samples the
+ *    result tracks exact LRU closely at a fraction of its bookkeeping.
+ *
+ *  Thread Safety :
+ *  > Not thread-safe; EvictionManager calls it under its partition lock.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../core/shard_manager.h"
+#include "eviction_manager.h"
+
+namespace kvmemo::eviction {
+
+/**
+ * @brief LRU approximated from sampled access clocks.
+ */
+class SampledLRUPolicy final : public EvictionPolicy {
+    public:
+    /**
+     * @brief Records sampled per victim unless configured otherwise.
+     */
+    static constexpr std::size_t kDefaultSamples = 5;
+
+    /**
+     * @brief Candidates kept between calls.
+     */
+    static constexpr std::size_t kPoolSize = 16;
+
+    explicit SampledLRUPolicy(std::size_t samples = kDefaultSamples)
+        : samples_(samples == 0 ? 1 : samples) {
+        pool_.reserve(kPoolSize);
+    }
+
+    void OnRead(std::string_view) override {}
+
+    void OnWrite(std::string_view) override {}
+
+    void OnDelete(std::string_view) override {}
+
+    void Clear() override {
+        pool_.clear();
+    }
+
+    std::optional<std::string> SelectVictim(const core::ShardManager& shards,
+                                            std::size_t shard) override {
+        // A second round only runs if every pooled candidate was stale.
+        for(int round = 0; round < 2; ++round) {
+            shards.Sample(shard, rng_(), samples_, [this](std::string_view key, std::uint32_t idle) {
+                Offer(key, idle);
+            });
+
+            while(!pool_.empty()) {
+                Candidate best = std::move(pool_.back());
+                pool_.pop_back();
+
+                // Idle time only grows until the key is used again.
+                const auto idle = shards.IdleTime(best.key);
+                if(idle.has_value() && *idle >= best.idle) {
+                    return std::move(best.key);
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool TracksAccesses() const noexcept override {
+        return false;
+    }
+
+    private:
+    struct Candidate {
+        std::string key;
+        std::uint32_t idle;
+    };
+
+    /**
+     * @brief Inserts @p key into the pool (ordered by ascending idle
+     *        time) if it is among the kPoolSize most idle keys seen.
+     *        A full pool reuses the dropped entry's key buffer.
+     */
+    void Offer(std::string_view key, std::uint32_t idle) {
+        if(pool_.size() == kPoolSize && idle <= pool_.front().idle) {
+            return;
+        }
+
+        auto same = std::find_if(pool_.begin(), pool_.end(),
+                                 [key](const Candidate& candidate) { return candidate.key == key; });
+        if(same != pool_.end()) {
+            // Already pooled; only its idle time moves it.
+            std::rotate(same, same + 1, pool_.end());
+            pool_.back().idle = idle;
+        }
+        else if(pool_.size() == kPoolSize) {
+            std::rotate(pool_.begin(), pool_.begin() + 1, pool_.end());
+            pool_.back().key.assign(key);
+            pool_.back().idle = idle;
+        }
+        else {
+            pool_.push_back(Candidate{std::string(key), idle});
+        }
+
+        // Sink the new entry to its place.
+        for(std::size_t i = pool_.size() - 1; i > 0 && pool_[i - 1].idle > idle; --i) {
+            std::swap(pool_[i - 1], pool_[i]);
+        }
+    }
+
+    const std::size_t samples_;
+    std::vector<Candidate> pool_;
+    std::minstd_rand rng_;
+};
+} // namespace kvmemo::eviction
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
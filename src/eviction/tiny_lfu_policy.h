@@ -0,0 +1,301 @@
+#pragma once
+/**
+ * @file tiny_lfu_policy.h
+ * @brief W-TinyLFU admission and eviction (EvictionPolicy::kTinyLFU).
+ *
+ *  Responsibilities :
+ *  - Keep keys that are popular over time resident when a stream of keys
+ *    that are used once (scans, one-hit wonders) passes through.
+ *  - Decide admission: a new key is only let into the main region if it
+ *    is more popular than the key it would displace.
+ *
+ *  Regions (after Caffeine) :
+ *  > Window   kWindowPercent of the keys, plain LRU. Every new key starts
+ *             here, so a burst of new keys can build up frequency.
+ *  > Main     Segmented LRU: probation, and protected (kProtectedPercent
+ *             of main). A probation hit promotes the key to protected;
+ *             protected overflow is demoted back to probation.
+ *  > Evictees Keys that lost admission, oldest first in line for
+ *             eviction. They stay readable until evicted; a hit brings
+ *             one back into the window.
+ *  > Keys leaving the window join main freely until main reaches its
+ *    capacity. After that each one competes with main's LRU victim, and
+ *    the one with the lower FrequencySketch estimate becomes an evictee.
+ *
+ *  Capacity :
+ *  > Eviction here is driven by memory, not by key count, so main's
+ *    capacity is learned: it is set to main's size whenever a victim is
+ *    requested, i.e. whenever memory is above the high watermark.
+ *
+ *  Admission :
+ *  > Admit() lets the engine drop a write of a new key under memory
+ *    pressure when the key is colder than the next victim, instead of
+ *    storing it and evicting a hotter key for it.
+ *
+ *  Memory :
+ *  > Keeps a node with a copy of every key of its shard, and a sketch of
+ *    about one byte per key. MemoryUsage() reports both, so they count
+ *    against the memory limit. Expired keys are dropped through OnDelete
+ *    like deleted ones, so no node outlives its record.
+ *
+ *  Thread Safety :
+ *  > Not thread-safe; EvictionManager calls it under its partition lock.
+ *
+ *  Copyright © 2026 Gagan Bansal
+ *  ALL RIGHT RESERVED
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../common/memory.h"
+#include "../core/flat_hash_map.h"
+#include "../core/intrusive_lru.h"
+#include "../core/shard_manager.h"
+#include "eviction_manager.h"
+#include "frequency_sketch.h"
+
+namespace kvmemo::eviction {
+
+/**
+ * @brief Window TinyLFU over the keys of one shard.
+ */
+class TinyLFUPolicy final : public EvictionPolicy {
+    public:
+    /**
+     * @brief Share of the keys kept in the admission window.
+     */
+    static constexpr std::size_t kWindowPercent = 1;
+
+    /**
+     * @brief Share of the main region kept in its protected segment.
+     */
+    static constexpr std::size_t kProtectedPercent = 80;
+
+    TinyLFUPolicy() = default;
+
+    TinyLFUPolicy(const TinyLFUPolicy&) = delete;
+    TinyLFUPolicy& operator=(const TinyLFUPolicy&) = delete;
+
+    void OnRead(std::string_view key) override {
+        const std::size_t hash = Nodes::hash_of(key);
+        sketch_.Increment(hash);
+
+        auto it = nodes_.find(key, hash);
+        if(it != nodes_.end()) {
+            OnHit(it->second.get());
+        }
+    }
+
+    void OnWrite(std::string_view key) override {
+        const std::size_t hash = Nodes::hash_of(key);
+        sketch_.Increment(hash);
+
+        auto it = nodes_.find(key, hash);
+        if(it != nodes_.end()) {
+            OnHit(it->second.get());
+            return;
+        }
+
+        auto node = std::make_unique<Node>();
+        node->key = std::string(key);
+        node->hash = hash;
+        node->region = Region::kWindow;
+
+        Node* added = node.get();
+        nodes_.try_emplace(std::string_view(added->key), std::move(node));
+        node_bytes_ += NodeBytes(*added);
+        window_.PushFront(added);
+
+        sketch_.EnsureCapacity(nodes_.size());
+        SpillWindow();
+    }
+
+    void OnDelete(std::string_view key) override {
+        auto it = nodes_.find(key);
+        if(it == nodes_.end()) {
+            return;
+        }
+
+        ListOf(it->second->region).Remove(it->second.get());
+        node_bytes_ -= NodeBytes(*it->second);
+        nodes_.erase(it);
+    }
+
+    void Clear() override {
+        window_.Clear();
+        probation_.Clear();
+        protected_.Clear();
+        evictees_.Clear();
+        nodes_.clear();
+        node_bytes_ = 0;
+        sketch_.Clear();
+        main_capacity_ = std::numeric_limits<std::size_t>::max();
+    }
+
+    std::size_t MemoryUsage() const noexcept override {
+        return node_bytes_ + nodes_.allocated_bytes() + sketch_.AllocatedBytes();
+    }
+
+    /**
+     * @brief Evictees first, then main's LRU end, then the window's.
+     */
+    std::optional<std::string> SelectVictim(const core::ShardManager&, std::size_t) override {
+        main_capacity_ = MainSize();
+
+        const Node* victim = NextVictim();
+        if(victim == nullptr) {
+            return std::nullopt;
+        }
+        return victim->key;
+    }
+
+    /**
+     * @brief Resident keys are always admitted. A new key is admitted if,
+     *        counting this write, it is at least as popular as the next
+     *        victim; a refused write still counts towards its popularity.
+     */
+    bool Admit(std::string_view key) override {
+        const std::size_t hash = Nodes::hash_of(key);
+        if(nodes_.find(key, hash) != nodes_.end()) {
+            return true;
+        }
+
+        const Node* victim = NextVictim();
+        if(victim == nullptr || sketch_.Frequency(hash) + 1 > sketch_.Frequency(victim->hash)) {
+            return true;
+        }
+
+        sketch_.Increment(hash);
+        return false;
+    }
+
+    /**
+     * @brief Keys currently tracked, evictees included.
+     */
+    std::size_t Size() const noexcept {
+        return nodes_.size();
+    }
+
+    private:
+    enum class Region : std::uint8_t {
+        kWindow,
+        kProbation,
+        kProtected,
+        kEvictee,
+    };
+
+    struct Node : core::LRUHook {
+        std::string key;
+        std::size_t hash{0};
+        Region region{Region::kWindow};
+    };
+
+    using Nodes = core::FlatHashMap<std::string_view, std::unique_ptr<Node>>;
+    using List = core::IntrusiveLRU<Node>;
+
+    static std::size_t NodeBytes(const Node& node) noexcept {
+        return common::AllocatedBytes(sizeof(Node)) + common::HeapBytes(node.key);
+    }
+
+    List& ListOf(Region region) noexcept {
+        switch(region) {
+            case Region::kWindow:
+                return window_;
+            case Region::kProbation:
+                return probation_;
+            case Region::kProtected:
+                return protected_;
+            default:
+                return evictees_;
+        }
+    }
+
+    void MoveTo(Node* node, Region region) noexcept {
+        ListOf(node->region).Remove(node);
+        node->region = region;
+        ListOf(region).PushFront(node);
+    }
+
+    std::size_t MainSize() const noexcept {
+        return probation_.Size() + protected_.Size();
+    }
+
+    const Node* NextVictim() const noexcept {
+        for(const List* list : {&evictees_, &probation_, &protected_, &window_}) {
+            if(!list->Empty()) {
+                return list->Back();
+            }
+        }
+        return nullptr;
+    }
+
+    void OnHit(Node* node) {
+        switch(node->region) {
+            case Region::kWindow:
+                window_.MoveToFront(node);
+                break;
+            case Region::kProtected:
+                protected_.MoveToFront(node);
+                break;
+            case Region::kProbation:
+                MoveTo(node, Region::kProtected);
+                while(protected_.Size() > MainSize() * kProtectedPercent / 100) {
+                    MoveTo(protected_.Back(), Region::kProbation);
+                }
+                break;
+            case Region::kEvictee:
+                MoveTo(node, Region::kWindow);
+                SpillWindow();
+                break;
+        }
+    }
+
+    /**
+     * @brief Moves keys beyond the window's share into main, each one
+     *        competing with main's victim once main is at capacity.
+     */
+    void SpillWindow() {
+        const std::size_t resident = window_.Size() + MainSize();
+        const std::size_t window_target = std::max<std::size_t>(1, resident * kWindowPercent / 100);
+
+        while(window_.Size() > window_target) {
+            Node* candidate = window_.Back();
+            Node* victim = probation_.Empty() ? protected_.Back() : probation_.Back();
+
+            if(MainSize() < main_capacity_ || victim == nullptr) {
+                MoveTo(candidate, Region::kProbation);
+            }
+            else if(sketch_.Frequency(candidate->hash) > sketch_.Frequency(victim->hash)) {
+                MoveTo(victim, Region::kEvictee);
+                MoveTo(candidate, Region::kProbation);
+            }
+            else {
+                MoveTo(candidate, Region::kEvictee);
+            }
+        }
+    }
+
+    Nodes nodes_;
+    std::size_t node_bytes_{0};
+    List window_;
+    List probation_;
+    List protected_;
+    List evictees_;
+    FrequencySketch sketch_;
+
+    // Main's size the last time memory pressure asked for a victim.
+    std::size_t main_capacity_{std::numeric_limits<std::size_t>::max()};
+};
+} // namespace kvmemo::eviction
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -2,74 +2,223 @@
 /**
  * @file ttl_manager.h
  * @brief Manages TTL-based expiration workflow in KVMemo.
- * 
+ *
  * Responsibility :
  *  TTLManager acts as the orchestration layer for time-based expiration.
- * 
- *  IT : 
- *  - Pulls expired keys from TTLIndex.
- *  - Delegates deletion to ShardManager.
- *  - Runs expiration cycle (sync or background driven).
- * 
- *  IT DOES NOT : 
+ *
+ *  IT :
+ *  - Runs the active expiry cycle on a background thread every
+ *    Config::ttl_sweep_interval_ms.
+ *  - Walks the shards incrementally, asking KVEngine to expire a bounded
+ *    batch of due keys at a time.
+ *  - Bounds each cycle by a time budget so no cycle causes a latency spike.
+ *
+ *  IT DOES NOT :
  *  - Track memory usage.
  *  - Handle LRU eviction.
  *  - Store actual key-value entries.
- *  
- *  Thread Safety : 
+ *
+ *  Active expiry (after Redis's active expire cycle) :
+ *  > A cycle may run for kBudgetPercent of the interval. It resumes at the
+ *    shard where the previous cycle stopped.
+ *  > Each step expires at most kKeysPerBatch keys of one shard under that
+ *    shard's lock. A full batch means the shard has a backlog, so the
+ *    cycle stays on it; a short batch moves on to the next shard.
+ *  > A cycle that runs out of budget before visiting every shard marks a
+ *    backlog: the next cycle starts after one budget's pause instead of a
+ *    full interval, so effort rises while many keys are due and falls
+ *    back to the interval once the backlog is gone.
+ *
+ *  Thread Safety :
  *  > Thread-Safe assuming underlying components are thread-safe.
- * 
+ *  > RunCycle() must not be called concurrently with itself.
+ *
  *  Copyright © 2026 Gagan Bansal
  *  ALL RIGHT RESERVED
  */
 
-#include <vector>
-#include <string>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#include "../common/time.h"
+#include "../core/kv_engine.h"
 
 namespace kvmemo::eviction {
-    class TTLIndex;
-    class ShardManager;
 
-    class TTLManager {
+    class TTLManager final {
         public:
-            /**
-             * @brief Constructs TTLManager.
-             * 
-             * @param ttl_index References to global TTL index.
-             * @param shard_manager References to shard manager.
-             */
-        TTLManager(TTLIndex& ttl_index, ShardManager& shard_manager) noexcept;
+        using Duration = std::chrono::microseconds;
+
+        /**
+         * @brief Keys expired per shard lock acquisition.
+         */
+        static constexpr std::size_t kKeysPerBatch = 64;
+
+        /**
+         * @brief Share of each interval a cycle may spend expiring keys.
+         */
+        static constexpr std::size_t kBudgetPercent = 25;
+
+        /**
+         * @brief Result of one expiration cycle.
+         */
+        struct CycleResult {
+            std::size_t expired{0};
+
+            // False if the budget ran out before every shard was visited.
+            bool complete{true};
+        };
+
+        /**
+         * @brief Constructs TTLManager.
+         *
+         * @param engine Engine whose shards are expired.
+         * @param interval Pause between cycles (Config::ttl_sweep_interval_ms).
+         */
+        TTLManager(core::KVEngine& engine, std::chrono::milliseconds interval)
+            : engine_(engine),
+              interval_(interval),
+              budget_(std::chrono::duration_cast<Duration>(interval) * kBudgetPercent / 100) {}
+
+        TTLManager(const TTLManager&) = delete;
+        TTLManager& operator=(const TTLManager&) = delete;
+
+        TTLManager(TTLManager&&) = delete;
+        TTLManager& operator=(TTLManager&&) = delete;
+
+        ~TTLManager() {
+            Stop();
+        }
+
+        /**
+         * @brief Starts the background thread; no-op if already running.
+         */
+        void Start() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(thread_.joinable()) {
+                return;
+            }
+
+            stop_ = false;
+            thread_ = std::thread([this] { Loop(); });
+        }
+
+        /**
+         * @brief Stops and joins the background thread.
+         */
+        void Stop() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_one();
+
+            if(thread_.joinable()) {
+                thread_.join();
+            }
+        }
 
         /**
          * @brief Runs one expiration cycle.
-         * 
-         * - fetches expired keys from TTLIndex
-         * - Deletes them via ShardManager.
-         * 
-         * @return Number of keys expired.
+         *
+         * - Expires due keys shard by shard from where the last cycle
+         *   stopped, until every shard was visited or @p budget elapsed.
+         *
+         * @return Keys expired and whether the cycle finished.
          */
-        size_t run_expiration_cycle();
+        CycleResult RunCycle(Duration budget) {
+            CycleResult result;
+
+            const std::size_t shards = engine_.ShardCount();
+            const auto deadline = common::Clock::NowSteady() + budget;
+            const std::uint64_t now = common::CoarseClock::Now();
+
+            for(std::size_t visited = 0; visited < shards;) {
+                const std::size_t expired = engine_.ExpireShard(next_shard_, now, kKeysPerBatch);
+                result.expired += expired;
+
+                if(expired < kKeysPerBatch) {
+                    next_shard_ = (next_shard_ + 1) % shards;
+                    ++visited;
+                }
+
+                if(visited < shards && common::Clock::NowSteady() >= deadline) {
+                    result.complete = false;
+                    break;
+                }
+            }
+
+            // Expiry retires records in lock-free mode; free what it can.
+            engine_.ReclaimRetired();
+
+            total_expired_.fetch_add(result.expired, std::memory_order_relaxed);
+            return result;
+        }
 
         /**
          * @brief Enables or disables TTL processing.
          */
-        void set_enabled(bool enabled) noexcept;
+        void SetEnabled(bool enabled) noexcept {
+            enabled_.store(enabled, std::memory_order_relaxed);
+        }
 
         /**
          * @brief Returns whether TTL expiration is enabled.
          */
-        bool is_enabled() const noexcept;
+        bool IsEnabled() const noexcept {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Keys expired by this manager since construction.
+         */
+        std::size_t TotalExpired() const noexcept {
+            return total_expired_.load(std::memory_order_relaxed);
+        }
 
         private:
-        TTLIndex& ttl_index_;
-        ShardManager& shard_manager_;
+        void Loop() {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            while(!stop_) {
+                Duration pause = interval_;
+
+                if(IsEnabled()) {
+                    lock.unlock();
+                    const CycleResult result = RunCycle(budget_);
+                    lock.lock();
+
+                    if(!result.complete) {
+                        pause = budget_;
+                    }
+                }
+
+                cv_.wait_for(lock, pause, [this] { return stop_; });
+            }
+        }
+
+        core::KVEngine& engine_;
+        const Duration interval_;
+        const Duration budget_;
+
+        // Shard the next cycle starts from; owned by the cycle's thread.
+        std::size_t next_shard_{0};
 
         std::atomic<bool> enabled_{true};
+        std::atomic<std::size_t> total_expired_{0};
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_{false};
+        std::thread thread_;
     };
 } // namespace kvmemo::eviction
 
 /**
  * This source code may not be copied, modified, or
  * distributed without explicit permission from the author.
- */
\ No newline at end of file
+ */
@@ -1,21 +1,92 @@
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
+#include "common/config.h"
+
 #include "server/server_app.h"
 
 using namespace kvmemo;
 
+/**
+ * @brief Prints the command line to stderr and returns the exit status
+ *        for a bad invocation.
+ */
+static int Usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [port] [threads] [option...]\n"
+              << "Options:\n"
+              << "  io_uring     serve on the io_uring backend\n"
+              << "  lockfree     lock-free GETs\n"
+              << "  sampled_lru  evict with sampled LRU\n"
+              << "  tinylfu      evict with W-TinyLFU\n"
+              << "  lfu          evict with LFU"
+              << std::endl;
+    return 2;
+}
+
 int main(int argc, char* argv[])
 {
-    int port = 6379;
+    common::Config config;
+    config.listen_port = 6379;
+
+    try
+    {
+        if (argc >= 2)
+        {
+            const unsigned long port = std::stoul(argv[1]);
+            if (port > UINT16_MAX)
+            {
+                throw std::out_of_range("port");
+            }
+            config.listen_port = static_cast<std::uint16_t>(port);
+        }
 
-    if (argc >= 2)
+        if (argc >= 3)
+        {
+            config.worker_threads = static_cast<std::size_t>(std::stoul(argv[2]));
+        }
+    }
+    catch (const std::exception&)
+    {
+        std::cerr << "Invalid port or thread count" << std::endl;
+        return Usage(argv[0]);
+    }
+
+    for (int i = 3; i < argc; ++i)
     {
-        port = std::stoi(argv[1]);
+        const std::string option(argv[i]);
+
+        if (option == "io_uring")
+        {
+            config.io_backend = common::IoBackend::kIoUring;
+        }
+        else if (option == "lockfree")
+        {
+            config.lock_free_reads = true;
+        }
+        else if (option == "sampled_lru")
+        {
+            config.eviction_policy = common::EvictionPolicy::kSampledLRU;
+        }
+        else if (option == "tinylfu")
+        {
+            config.eviction_policy = common::EvictionPolicy::kTinyLFU;
+        }
+        else if (option == "lfu")
+        {
+            config.eviction_policy = common::EvictionPolicy::kLFU;
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return Usage(argv[0]);
+        }
     }
 
     std::cout << "Starting KVMemo Server..." << std::endl;
-    std::cout << "Listening on port " << port << std::endl;
+    std::cout << "Listening on port " << config.listen_port << std::endl;
 
     try
     {
@@ -25,7 +96,9 @@ int main(int argc, char* argv[])
          * ------------------------------------------------------------
          */
 
-        server::ServerApp server(port);
+        server::ServerApp server(config);
+
+        std::cout << "Event loop threads: " << server.EventLoopCount() << std::endl;
 
         /**
          * ------------------------------------------------------------
@@ -18,11 +18,18 @@
  *  ALL RIGHTS RESERVED.
  */
 
+#include <sys/socket.h>
+#include <sys/types.h>
 #include <unistd.h>
+
+#include <array>
+#include <cerrno>
 #include <string>
 #include <stdexcept>
 
 #include "../protocol/buffer.h"
+#include "../protocol/wire_codec.h"
+#include "output_queue.h"
 
 namespace kvmemo::net
 {
@@ -32,6 +39,24 @@ namespace kvmemo::net
     class Connection final
     {
     public:
+        /**
+         * @brief Per-connection bookkeeping for the io_uring backend.
+         *
+         * While a send is in flight the kernel reads from @p inflight (through
+         * @p msg / @p iov), so replies produced meanwhile go to the regular
+         * output buffer and are swapped in once the send completes.
+         */
+        struct UringState
+        {
+            bool recv_armed{false};
+            bool send_inflight{false};
+            bool closing{false};
+            bool shut_down{false};
+            OutputQueue inflight;
+            msghdr msg{};
+            std::array<iovec, OutputQueue::kMaxIovecs> iov{};
+        };
+
         explicit Connection(int fd) : fd_(fd) {}
 
         Connection(const Connection &) = delete;
@@ -64,44 +89,160 @@ namespace kvmemo::net
         /**
          * @brief Returns output buffer.
          */
-        protocol::Buffer &OutputBuffer() noexcept
+        OutputQueue &OutputBuffer() noexcept
         {
             return output_buffer_;
         }
 
         /**
          * @brief Reads available data from socket into input buffer.
+         *
+         * The socket is non-blocking and registered edge-triggered, so this
+         * drains the socket until the kernel reports EAGAIN.
+         *
+         * @return Bytes read (may be 0 on a spurious wakeup), or -1 on a
+         *         socket error. End-of-stream is reported via PeerClosed().
          */
         ssize_t ReadFromSocket()
         {
-            char temp[4096];
-
-            size_t bytes = ::read(fd_, temp, sizeof(temp));
+            ssize_t total = 0;
 
-            if (bytes > 0)
+            while (true)
             {
-                input_buffer_.Append(temp, static_cast<std::size_t>(bytes));
-            }
+                char temp[4096];
 
-            return bytes;
+                ssize_t bytes = ::read(fd_, temp, sizeof(temp));
+
+                if (bytes > 0)
+                {
+                    input_buffer_.Append(temp, static_cast<std::size_t>(bytes));
+                    total += bytes;
+                    continue;
+                }
+
+                if (bytes == 0)
+                {
+                    peer_closed_ = true;
+                    return total;
+                }
+
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    return total;
+                }
+
+                return -1;
+            }
         }
 
         /**
          * @brief Writes buffered data to socket.
+         *
+         * Sends until the output buffer is empty or the kernel send buffer is
+         * full, gathering all queued replies into each sendmsg(). Bytes the
+         * kernel does not accept stay in the output buffer and are retried
+         * once the socket becomes writable again.
+         *
+         * @return Bytes written (0 if the socket would block), or -1 on a
+         *         socket error.
          */
-        size_t WriteToSocket()
+        ssize_t WriteToSocket()
         {
-            const char *data = output_buffer_.Data();
-            std::size_t size = output_buffer_.ReadableBytes();
-
-            ssize_t bytes = ::write(fd_, data, size);
+            ssize_t total = 0;
+            std::array<iovec, OutputQueue::kMaxIovecs> iov;
 
-            if (bytes > 0)
+            while (output_buffer_.ReadableBytes() > 0)
             {
-                output_buffer_.Consume(static_cast<std::size_t>(bytes));
+                msghdr msg{};
+                msg.msg_iov = iov.data();
+                msg.msg_iovlen = static_cast<std::size_t>(
+                    output_buffer_.Gather(iov.data(), static_cast<int>(iov.size())));
+
+                ssize_t bytes = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+
+                if (bytes > 0)
+                {
+                    output_buffer_.Consume(static_cast<std::size_t>(bytes));
+                    total += bytes;
+                    continue;
+                }
+
+                if (bytes < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+
+                if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    break;
+                }
+
+                return -1;
             }
 
-            return bytes;
+            return total;
+        }
+
+        /**
+         * @brief Returns io_uring backend state (unused by epoll).
+         */
+        UringState &Uring() noexcept
+        {
+            return uring_;
+        }
+
+        /**
+         * @brief Returns the wire format negotiated on this connection.
+         */
+        protocol::WireFormat Format() const noexcept
+        {
+            return format_;
+        }
+
+        void SetFormat(protocol::WireFormat format) noexcept
+        {
+            format_ = format;
+        }
+
+        /**
+         * @brief Input bytes already searched for a frame delimiter, so a
+         *        partially received frame is not rescanned on every read.
+         */
+        std::size_t ScanOffset() const noexcept
+        {
+            return scan_offset_;
+        }
+
+        void SetScanOffset(std::size_t offset) noexcept
+        {
+            scan_offset_ = offset;
+        }
+
+        /**
+         * @brief Returns true while reading is paused because too much output
+         *        is waiting to be sent.
+         */
+        bool ReadPaused() const noexcept
+        {
+            return read_paused_;
+        }
+
+        void SetReadPaused(bool paused) noexcept
+        {
+            read_paused_ = paused;
+        }
+
+        /**
+         * @brief Returns true once the peer has shut down its sending side.
+         */
+        bool PeerClosed() const noexcept
+        {
+            return peer_closed_;
         }
 
         /**
@@ -118,9 +259,15 @@ namespace kvmemo::net
 
     private:
         int fd_{-1};
+        bool peer_closed_{false};
+        bool read_paused_{false};
+        protocol::WireFormat format_{protocol::WireFormat::kText};
+        std::size_t scan_offset_{0};
 
         protocol::Buffer input_buffer_;
-        protocol::Buffer output_buffer_;
+        OutputQueue output_buffer_;
+
+        UringState uring_;
     };
 } // namespace kvmemo::net
 
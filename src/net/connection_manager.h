@@ -81,6 +81,16 @@ public:
         return it->second.get();
     }
 
+    /**
+     * @brief Returns connection by socket descriptor, or nullptr.
+     */
+    Connection* Find(int fd) noexcept
+    {
+        auto it = connections_.find(fd);
+
+        return it == connections_.end() ? nullptr : it->second.get();
+    }
+
     /**
      * @brief Returns number of active connections.
      */
@@ -0,0 +1,209 @@
+#pragma once
+/**
+ * @file event_loop.h
+ * @brief epoll based readiness reactor used by the network layer.
+ *
+ *  Responsibilities :
+ *  - Own the epoll instance.
+ *  - Register / modify / unregister file descriptors.
+ *  - Wait for readiness and report only the descriptors that are ready.
+ *
+ *  Design :
+ *  > All descriptors are registered edge-triggered (EPOLLET), so every
+ *    readiness notification must be drained by the caller until the
+ *    kernel reports EAGAIN.
+ *  > Descriptors handed to the loop must be non-blocking.
+ *  > Work per Poll() is O(ready descriptors), independent of how many
+ *    connections are registered, and there is no descriptor cap such as
+ *    FD_SETSIZE.
+ *  > An internal eventfd lets other threads interrupt a blocking Poll().
+ *
+ *  Thread Safety :
+ *  > Not thread-safe, except Wakeup() which may be called from any thread.
+ *  > Intended to be owned and driven by a single event-loop thread.
+ *
+ *  Copyright © 2026 KVMemo
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace kvmemo::net
+{
+    /**
+     * @brief Edge-triggered epoll reactor.
+     */
+    class EventLoop final
+    {
+    public:
+        /**
+         * @brief Interest / readiness flags understood by the loop.
+         */
+        static constexpr std::uint32_t kReadable = EPOLLIN | EPOLLRDHUP;
+        static constexpr std::uint32_t kWritable = EPOLLOUT;
+        static constexpr std::uint32_t kError = EPOLLERR | EPOLLHUP;
+
+        /**
+         * @brief Blocks in Poll() until at least one descriptor is ready.
+         */
+        static constexpr int kNoTimeout = -1;
+
+        explicit EventLoop(std::size_t max_events = kDefaultMaxEvents)
+            : epoll_fd_(::epoll_create1(EPOLL_CLOEXEC)),
+              events_(max_events == 0 ? kDefaultMaxEvents : max_events)
+        {
+            if (epoll_fd_ < 0)
+            {
+                throw std::runtime_error("Failed to create epoll instance");
+            }
+
+            wakeup_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+            if (wakeup_fd_ < 0)
+            {
+                ::close(epoll_fd_);
+                throw std::runtime_error("Failed to create wakeup eventfd");
+            }
+
+            Add(wakeup_fd_, kReadable);
+        }
+
+        EventLoop(const EventLoop &) = delete;
+        EventLoop &operator=(const EventLoop &) = delete;
+
+        EventLoop(EventLoop &&) = delete;
+        EventLoop &operator=(EventLoop &&) = delete;
+
+        ~EventLoop()
+        {
+            ::close(wakeup_fd_);
+            ::close(epoll_fd_);
+        }
+
+        /**
+         * @brief Registers a descriptor for the given interest set.
+         */
+        void Add(int fd, std::uint32_t interest)
+        {
+            Control(EPOLL_CTL_ADD, fd, interest);
+        }
+
+        /**
+         * @brief Replaces the interest set of a registered descriptor.
+         */
+        void Modify(int fd, std::uint32_t interest)
+        {
+            Control(EPOLL_CTL_MOD, fd, interest);
+        }
+
+        /**
+         * @brief Unregisters a descriptor.
+         *
+         * Closing a descriptor also removes it from epoll, so failures here
+         * are ignored.
+         */
+        void Remove(int fd) noexcept
+        {
+            ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+        }
+
+        /**
+         * @brief Waits for readiness and invokes callback(fd, events) for
+         *        every ready descriptor.
+         *
+         * @param timeout_ms Milliseconds to wait, or kNoTimeout.
+         * @return Number of ready descriptors (0 on timeout or EINTR).
+         */
+        template <typename Callback>
+        int Poll(int timeout_ms, Callback &&callback)
+        {
+            const int ready = ::epoll_wait(epoll_fd_,
+                                           events_.data(),
+                                           static_cast<int>(events_.size()),
+                                           timeout_ms);
+
+            if (ready < 0)
+            {
+                if (errno == EINTR)
+                {
+                    return 0;
+                }
+                throw std::runtime_error("epoll_wait failed");
+            }
+
+            for (int i = 0; i < ready; ++i)
+            {
+                if (events_[i].data.fd == wakeup_fd_)
+                {
+                    DrainWakeup();
+                    continue;
+                }
+
+                callback(events_[i].data.fd, events_[i].events);
+            }
+
+            return ready;
+        }
+
+        /**
+         * @brief Interrupts a Poll() blocked on another thread.
+         */
+        void Wakeup() noexcept
+        {
+            std::uint64_t one = 1;
+            [[maybe_unused]] ssize_t written = ::write(wakeup_fd_, &one, sizeof(one));
+        }
+
+        /**
+         * @brief Returns the wakeup eventfd, for I/O backends that wait on
+         *        something other than epoll.
+         */
+        int WakeupFD() const noexcept
+        {
+            return wakeup_fd_;
+        }
+
+        /**
+         * @brief Clears pending wakeups.
+         */
+        void DrainWakeup() noexcept
+        {
+            std::uint64_t counter = 0;
+            while (::read(wakeup_fd_, &counter, sizeof(counter)) > 0)
+            {
+            }
+        }
+
+    private:
+        static constexpr std::size_t kDefaultMaxEvents = 256;
+
+        void Control(int op, int fd, std::uint32_t interest)
+        {
+            epoll_event event{};
+            event.events = interest | EPOLLET;
+            event.data.fd = fd;
+
+            if (::epoll_ctl(epoll_fd_, op, fd, &event) < 0)
+            {
+                throw std::runtime_error("epoll_ctl failed");
+            }
+        }
+
+        int epoll_fd_{-1};
+        int wakeup_fd_{-1};
+        std::vector<epoll_event> events_;
+    };
+} // namespace kvmemo::net
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
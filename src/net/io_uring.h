@@ -0,0 +1,494 @@
+#pragma once
+/**
+ * @file io_uring.h
+ * @brief Minimal io_uring wrapper used by the optional io_uring I/O backend.
+ *
+ *  Responsibilities :
+ *  - Set up and map a submission / completion ring pair.
+ *  - Hand out SQEs and submit them in batches with one io_uring_enter().
+ *  - Register a pool of provided buffers so multishot receives can pick
+ *    kernel side buffers without a per-read syscall.
+ *
+ *  Design :
+ *  > Talks to the kernel through the raw syscalls and <linux/io_uring.h>,
+ *    so the backend has no third-party dependency.
+ *  > Only compiled when the build defines KVMEMO_WITH_IO_URING (CMake
+ *    option KVMEMO_ENABLE_IO_URING).
+ *  > Construction throws std::runtime_error if the running kernel cannot
+ *    provide what the backend needs; callers fall back to epoll.
+ *  > Buffers are handed to the kernel through a provided-buffer ring when
+ *    it works, otherwise with IORING_OP_PROVIDE_BUFFERS requests that ride
+ *    along with the next Submit(). Some kernels accept the ring
+ *    registration but never select from it, so the ring is probed once.
+ *
+ *  Thread Safety :
+ *  > Not thread-safe.
+ *  > Owned and driven by a single event-loop thread.
+ *
+ *  Copyright © 2026 KVMemo
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#if defined(KVMEMO_WITH_IO_URING)
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace kvmemo::net
+{
+    /**
+     * @brief Submission / completion ring pair plus one provided-buffer ring.
+     */
+    class IoUring final
+    {
+    public:
+        /**
+         * @param entries Submission queue size (rounded up by the kernel).
+         */
+        explicit IoUring(unsigned entries)
+        {
+            io_uring_params params{};
+            params.flags = IORING_SETUP_CQSIZE;
+            params.cq_entries = entries * 4;
+
+            ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (ring_fd_ < 0)
+            {
+                throw std::runtime_error("io_uring_setup failed");
+            }
+
+            if (!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+                !(params.features & IORING_FEAT_NODROP))
+            {
+                ::close(ring_fd_);
+                throw std::runtime_error("io_uring kernel support is too old");
+            }
+
+            const std::size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            const std::size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            ring_size_ = sq_size > cq_size ? sq_size : cq_size;
+
+            ring_ = ::mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+            if (ring_ == MAP_FAILED)
+            {
+                ::close(ring_fd_);
+                throw std::runtime_error("io_uring ring mmap failed");
+            }
+
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            void *sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED)
+            {
+                ::munmap(ring_, ring_size_);
+                ::close(ring_fd_);
+                throw std::runtime_error("io_uring sqe mmap failed");
+            }
+            sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+            char *base = static_cast<char *>(ring_);
+            sq_head_ = reinterpret_cast<unsigned *>(base + params.sq_off.head);
+            sq_tail_ = reinterpret_cast<unsigned *>(base + params.sq_off.tail);
+            sq_mask_ = *reinterpret_cast<unsigned *>(base + params.sq_off.ring_mask);
+            sq_entries_ = params.sq_entries;
+            cq_head_ = reinterpret_cast<unsigned *>(base + params.cq_off.head);
+            cq_tail_ = reinterpret_cast<unsigned *>(base + params.cq_off.tail);
+            cq_mask_ = *reinterpret_cast<unsigned *>(base + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe *>(base + params.cq_off.cqes);
+
+            // SQEs are always used in ring order, so the indirection array is
+            // the identity mapping.
+            unsigned *array = reinterpret_cast<unsigned *>(base + params.sq_off.array);
+            for (unsigned i = 0; i < sq_entries_; ++i)
+            {
+                array[i] = i;
+            }
+
+            sqe_tail_ = *sq_tail_;
+        }
+
+        IoUring(const IoUring &) = delete;
+        IoUring &operator=(const IoUring &) = delete;
+
+        IoUring(IoUring &&) = delete;
+        IoUring &operator=(IoUring &&) = delete;
+
+        ~IoUring()
+        {
+            if (buffers_ != nullptr)
+            {
+                ::munmap(buffers_, buffer_count_ * buffer_size_);
+            }
+            if (buf_ring_ != nullptr)
+            {
+                ::munmap(buf_ring_, buffer_count_ * sizeof(io_uring_buf));
+            }
+            ::munmap(sqes_, sqes_size_);
+            ::munmap(ring_, ring_size_);
+            ::close(ring_fd_);
+        }
+
+        /**
+         * @brief Returns true if the running kernel supports multishot
+         *        receive with provided-buffer rings (Linux 6.0+).
+         */
+        static bool KernelSupportsMultishotRecv() noexcept
+        {
+            utsname name{};
+            if (::uname(&name) != 0)
+            {
+                return false;
+            }
+
+            int major = 0;
+            if (std::sscanf(name.release, "%d", &major) != 1)
+            {
+                return false;
+            }
+
+            return major >= 6;
+        }
+
+        /**
+         * @brief Returns the next free SQE (zeroed), or nullptr if the
+         *        submission queue is full.
+         */
+        io_uring_sqe *GetSqe() noexcept
+        {
+            const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            if (sqe_tail_ - head >= sq_entries_)
+            {
+                return nullptr;
+            }
+
+            io_uring_sqe *sqe = &sqes_[sqe_tail_ & sq_mask_];
+            ++sqe_tail_;
+            std::memset(sqe, 0, sizeof(*sqe));
+            return sqe;
+        }
+
+        /**
+         * @brief Publishes queued SQEs and recycled buffers, then enters the
+         *        kernel once.
+         *
+         * @param wait_nr Completions to wait for (0 = submit only).
+         * @return Number of SQEs consumed by the kernel.
+         */
+        int Submit(unsigned wait_nr)
+        {
+            PublishBuffers();
+
+            const unsigned to_submit = sqe_tail_ - *sq_tail_;
+            __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+
+            if (to_submit == 0 && wait_nr == 0)
+            {
+                return 0;
+            }
+
+            const unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+            const long ret = ::syscall(__NR_io_uring_enter, ring_fd_, to_submit, wait_nr,
+                                       flags, nullptr, 0);
+            if (ret < 0)
+            {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                {
+                    return 0;
+                }
+                throw std::runtime_error("io_uring_enter failed");
+            }
+
+            return static_cast<int>(ret);
+        }
+
+        /**
+         * @brief user_data reserved for requests the wrapper issues itself;
+         *        their completions are never reported.
+         */
+        static constexpr std::uint64_t kInternalUserData = 0;
+
+        /**
+         * @brief Invokes callback(cqe) for every available completion and
+         *        releases them back to the kernel.
+         */
+        template <typename Callback>
+        unsigned DrainCompletions(Callback &&callback)
+        {
+            unsigned head = *cq_head_;
+            const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            unsigned count = 0;
+
+            while (head != tail)
+            {
+                const io_uring_cqe cqe = cqes_[head & cq_mask_];
+                ++head;
+                ++count;
+                __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+                if (cqe.user_data != kInternalUserData)
+                {
+                    callback(cqe);
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Provides @p count buffers of @p buffer_size bytes each to the
+         *        kernel under buffer group @p group.
+         *
+         *        Must be called before anything else is submitted.
+         *
+         * @param count Number of buffers; must be a power of two.
+         */
+        void RegisterBuffers(std::uint16_t group, unsigned count, std::size_t buffer_size)
+        {
+            buffer_group_ = group;
+            buffer_count_ = count;
+            buffer_size_ = buffer_size;
+            buffer_mask_ = static_cast<std::uint16_t>(count - 1);
+
+            void *buffers = ::mmap(nullptr, count * buffer_size, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (buffers == MAP_FAILED)
+            {
+                throw std::runtime_error("io_uring buffer pool allocation failed");
+            }
+            buffers_ = static_cast<char *>(buffers);
+
+            if (RegisterBufferRing() && BufferRingWorks())
+            {
+                return;
+            }
+
+            UnregisterBufferRing();
+
+            io_uring_sqe *sqe = GetSqe();
+            sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+            sqe->fd = static_cast<int>(count);
+            sqe->addr = reinterpret_cast<std::uint64_t>(buffers_);
+            sqe->len = static_cast<std::uint32_t>(buffer_size);
+            sqe->buf_group = group;
+            sqe->user_data = kProbeUserData;
+
+            if (WaitOne() < 0)
+            {
+                throw std::runtime_error("io_uring provided buffer registration failed");
+            }
+        }
+
+        /**
+         * @brief Returns the memory of provided buffer @p bid.
+         */
+        const char *BufferData(std::uint16_t bid) const noexcept
+        {
+            return buffers_ + static_cast<std::size_t>(bid) * buffer_size_;
+        }
+
+        /**
+         * @brief Hands buffer @p bid back to the kernel (published on the
+         *        next Submit()).
+         */
+        void RecycleBuffer(std::uint16_t bid)
+        {
+            if (buf_ring_ == nullptr)
+            {
+                recycled_.push_back(bid);
+                return;
+            }
+
+            io_uring_buf *buf = &buf_ring_->bufs[buf_tail_ & buffer_mask_];
+            buf->addr = reinterpret_cast<std::uint64_t>(buffers_ + static_cast<std::size_t>(bid) * buffer_size_);
+            buf->len = static_cast<std::uint32_t>(buffer_size_);
+            buf->bid = bid;
+            ++buf_tail_;
+        }
+
+    private:
+        static constexpr std::uint64_t kProbeUserData = ~std::uint64_t{0};
+
+        bool RegisterBufferRing()
+        {
+            void *ring = ::mmap(nullptr, buffer_count_ * sizeof(io_uring_buf), PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ring == MAP_FAILED)
+            {
+                return false;
+            }
+            buf_ring_ = static_cast<io_uring_buf_ring *>(ring);
+
+            io_uring_buf_reg reg{};
+            reg.ring_addr = reinterpret_cast<std::uint64_t>(buf_ring_);
+            reg.ring_entries = buffer_count_;
+            reg.bgid = buffer_group_;
+
+            if (::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+            {
+                ::munmap(buf_ring_, buffer_count_ * sizeof(io_uring_buf));
+                buf_ring_ = nullptr;
+                return false;
+            }
+
+            for (unsigned bid = 0; bid < buffer_count_; ++bid)
+            {
+                RecycleBuffer(static_cast<std::uint16_t>(bid));
+            }
+            PublishBuffers();
+            return true;
+        }
+
+        void UnregisterBufferRing() noexcept
+        {
+            if (buf_ring_ == nullptr)
+            {
+                return;
+            }
+
+            io_uring_buf_reg reg{};
+            reg.bgid = buffer_group_;
+            ::syscall(__NR_io_uring_register, ring_fd_, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+
+            ::munmap(buf_ring_, buffer_count_ * sizeof(io_uring_buf));
+            buf_ring_ = nullptr;
+            buf_tail_ = 0;
+        }
+
+        /**
+         * @brief Receives one byte over a socketpair through the buffer ring.
+         */
+        bool BufferRingWorks()
+        {
+            int pair[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair) != 0)
+            {
+                return false;
+            }
+
+            const char byte = 0;
+            bool works = ::write(pair[1], &byte, 1) == 1;
+
+            if (works)
+            {
+                io_uring_sqe *sqe = GetSqe();
+                sqe->opcode = IORING_OP_RECV;
+                sqe->fd = pair[0];
+                sqe->flags = IOSQE_BUFFER_SELECT;
+                sqe->buf_group = buffer_group_;
+                sqe->user_data = kProbeUserData;
+
+                std::uint32_t flags = 0;
+                works = WaitOne(&flags) == 1 && (flags & IORING_CQE_F_BUFFER);
+
+                if (works)
+                {
+                    RecycleBuffer(static_cast<std::uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT));
+                    PublishBuffers();
+                }
+            }
+
+            ::close(pair[0]);
+            ::close(pair[1]);
+            return works;
+        }
+
+        /**
+         * @brief Submits and returns the result of a single setup-time request.
+         */
+        int WaitOne(std::uint32_t *flags = nullptr)
+        {
+            Submit(1);
+
+            int res = -EIO;
+            while (DrainCompletions([&](const io_uring_cqe &cqe)
+                                    {
+                                        res = cqe.res;
+                                        if (flags != nullptr)
+                                        {
+                                            *flags = cqe.flags;
+                                        }
+                                    }) == 0)
+            {
+                Submit(1);
+            }
+            return res;
+        }
+
+        void PublishBuffers()
+        {
+            if (buf_ring_ != nullptr)
+            {
+                __atomic_store_n(&buf_ring_->tail, buf_tail_, __ATOMIC_RELEASE);
+                return;
+            }
+
+            while (!recycled_.empty())
+            {
+                io_uring_sqe *sqe = GetSqe();
+                if (sqe == nullptr)
+                {
+                    return;
+                }
+
+                const std::uint16_t bid = recycled_.back();
+                recycled_.pop_back();
+
+                sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+                sqe->fd = 1;
+                sqe->addr = reinterpret_cast<std::uint64_t>(BufferData(bid));
+                sqe->len = static_cast<std::uint32_t>(buffer_size_);
+                sqe->off = bid;
+                sqe->buf_group = buffer_group_;
+                sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+                sqe->user_data = kInternalUserData;
+            }
+        }
+
+        int ring_fd_{-1};
+
+        void *ring_{nullptr};
+        std::size_t ring_size_{0};
+        io_uring_sqe *sqes_{nullptr};
+        std::size_t sqes_size_{0};
+
+        unsigned *sq_head_{nullptr};
+        unsigned *sq_tail_{nullptr};
+        unsigned sq_mask_{0};
+        unsigned sq_entries_{0};
+        unsigned sqe_tail_{0};
+
+        unsigned *cq_head_{nullptr};
+        unsigned *cq_tail_{nullptr};
+        unsigned cq_mask_{0};
+        io_uring_cqe *cqes_{nullptr};
+
+        io_uring_buf_ring *buf_ring_{nullptr};
+        std::vector<std::uint16_t> recycled_;
+        char *buffers_{nullptr};
+        std::uint16_t buffer_group_{0};
+        unsigned buffer_count_{0};
+        std::size_t buffer_size_{0};
+        std::uint16_t buffer_mask_{0};
+        std::uint16_t buf_tail_{0};
+    };
+} // namespace kvmemo::net
+
+#endif // KVMEMO_WITH_IO_URING
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -0,0 +1,230 @@
+#pragma once
+/**
+ * @file output_queue.h
+ * @brief Segmented queue of reply bytes waiting to be written to a socket.
+ *
+ *  Responsibilities :
+ *  - Collect every reply produced while handling one read batch.
+ *  - Expose the pending bytes as an iovec array so the whole batch goes
+ *    out with a single sendmsg().
+ *
+ *  Design :
+ *  > Small replies are copied into a shared tail segment, so a pipeline of
+ *    short replies stays one contiguous iovec.
+ *  > Large replies handed over as rvalues are spliced in as their own
+ *    segment instead of being copied again.
+ *  > A large stored value arrives as a common::Blob; its segment keeps a
+ *    reference and points at the stored bytes, so they are written to the
+ *    socket straight from the store.
+ *
+ *  Thread Safety :
+ *  > Not thread-safe.
+ *  > Owned by a Connection and driven by its event-loop thread.
+ *
+ *  Copyright © 2026 KVMemo
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../common/blob.h"
+
+namespace kvmemo::net
+{
+    /**
+     * @brief FIFO of reply segments with gather support.
+     */
+    class OutputQueue final
+    {
+    public:
+        /**
+         * @brief Moved-in strings at least this large become their own
+         *        segment rather than being copied into the tail.
+         */
+        static constexpr std::size_t kSpliceThreshold = 16 * 1024;
+
+        /**
+         * @brief Upper bound on iovecs handed to one sendmsg().
+         */
+        static constexpr int kMaxIovecs = 64;
+
+        OutputQueue() = default;
+
+        OutputQueue(const OutputQueue &) = delete;
+        OutputQueue &operator=(const OutputQueue &) = delete;
+
+        OutputQueue(OutputQueue &&) noexcept = default;
+        OutputQueue &operator=(OutputQueue &&) noexcept = default;
+
+        ~OutputQueue() = default;
+
+        /**
+         * @brief Copies bytes to the end of the queue.
+         */
+        void Append(const char *data, std::size_t len)
+        {
+            if (len == 0)
+            {
+                return;
+            }
+
+            if (!tail_shared_ || segments_.empty())
+            {
+                segments_.emplace_back();
+                tail_shared_ = true;
+            }
+
+            segments_.back().bytes.append(data, len);
+            readable_ += len;
+        }
+
+        void Append(const std::string &data)
+        {
+            Append(data.data(), data.size());
+        }
+
+        /**
+         * @brief Appends a string, taking ownership of large ones.
+         */
+        void Append(std::string &&data)
+        {
+            if (data.size() < kSpliceThreshold)
+            {
+                Append(data.data(), data.size());
+                return;
+            }
+
+            readable_ += data.size();
+            segments_.emplace_back().bytes = std::move(data);
+            tail_shared_ = false;
+        }
+
+        /**
+         * @brief Appends shared bytes, referencing large ones in place.
+         */
+        void Append(common::Blob &&data)
+        {
+            if (data.Size() < kSpliceThreshold)
+            {
+                Append(data.Data(), data.Size());
+                return;
+            }
+
+            readable_ += data.Size();
+            segments_.emplace_back().shared = std::move(data);
+            tail_shared_ = false;
+        }
+
+        /**
+         * @brief Number of bytes not yet consumed.
+         */
+        std::size_t ReadableBytes() const noexcept
+        {
+            return readable_;
+        }
+
+        /**
+         * @brief Fills @p iov with the unconsumed bytes, front first.
+         *
+         * @return Number of iovecs filled (at most @p max).
+         */
+        int Gather(iovec *iov, int max) const noexcept
+        {
+            int count = 0;
+            std::size_t offset = head_offset_;
+
+            for (auto it = segments_.begin(); it != segments_.end() && count < max; ++it)
+            {
+                iov[count].iov_base = const_cast<char *>(it->Data() + offset);
+                iov[count].iov_len = it->Size() - offset;
+                offset = 0;
+                ++count;
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Drops @p len bytes from the front of the queue.
+         */
+        void Consume(std::size_t len)
+        {
+            if (len > readable_)
+            {
+                throw std::out_of_range("OutputQueue consume beyond readable data");
+            }
+
+            readable_ -= len;
+
+            while (len > 0)
+            {
+                const std::size_t available = segments_.front().Size() - head_offset_;
+
+                if (len < available)
+                {
+                    head_offset_ += len;
+                    return;
+                }
+
+                len -= available;
+                segments_.pop_front();
+                head_offset_ = 0;
+            }
+
+            if (segments_.empty())
+            {
+                tail_shared_ = false;
+            }
+        }
+
+        /**
+         * @brief Drops everything.
+         */
+        void Clear() noexcept
+        {
+            segments_.clear();
+            head_offset_ = 0;
+            readable_ = 0;
+            tail_shared_ = false;
+        }
+
+    private:
+        /**
+         * @brief Owned bytes, or a reference to a stored value.
+         */
+        struct Segment
+        {
+            std::string bytes;
+            common::Blob shared;
+
+            const char *Data() const noexcept
+            {
+                return shared.Empty() ? bytes.data() : shared.Data();
+            }
+
+            std::size_t Size() const noexcept
+            {
+                return shared.Empty() ? bytes.size() : shared.Size();
+            }
+        };
+
+        std::deque<Segment> segments_;
+        std::size_t head_offset_{0};
+        std::size_t readable_{0};
+
+        // True if the last segment accepts copied appends.
+        bool tail_shared_{false};
+    };
+} // namespace kvmemo::net
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -21,9 +21,12 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cstring>
 #include <stdexcept>
+#include <string>
 
+#include "../common/logger.h"
 #include "connection.h"
 #include "connection_manager.h"
 
@@ -35,7 +38,14 @@ namespace kvmemo::net
     class TcpServer final
     {
     public:
-        explicit TcpServer(int port) : port_(port) {};
+        /**
+         * @param port TCP port to listen on.
+         * @param reuse_port Sets SO_REUSEPORT so several servers (one per
+         *        event-loop thread) can bind the same port and let the kernel
+         *        balance incoming connections between them.
+         */
+        explicit TcpServer(int port, bool reuse_port = false)
+            : port_(port), reuse_port_(reuse_port) {};
 
         TcpServer(const TcpServer &) = delete;
         TcpServer &operator=(const TcpServer &) = delete;
@@ -59,25 +69,41 @@ namespace kvmemo::net
         }
 
         /**
-         * @brief Accepts a new client connection.
+         * @brief Accepts one pending client connection.
+         *
+         * The listening socket is non-blocking, so callers drain the accept
+         * queue by calling this until it returns -1. Accepted sockets are
+         * non-blocking as well and are registered with ConnectionManager.
+         *
+         * @return Client socket descriptor, or -1 if no connection is pending.
          */
-        void Accept()
+        int Accept()
         {
             sockaddr_in client_addr{};
             socklen_t addr_len = sizeof(client_addr);
 
-            int client_fd = ::accept(
+            int client_fd = ::accept4(
                 listen_fd_,
                 reinterpret_cast<sockaddr *>(&client_addr),
-                &addr_len);
+                &addr_len,
+                SOCK_NONBLOCK | SOCK_CLOEXEC);
 
             if (client_fd < 0)
             {
-                throw std::runtime_error("Failed to accept connection");
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ||
+                    errno == ECONNABORTED)
+                {
+                    return -1;
+                }
+
+                KV_LOG_WARN(std::string("Failed to accept connection: ") + std::strerror(errno));
+                return -1;
             }
 
             auto conn = std::make_unique<kvmemo::net::Connection>(client_fd);
             connection_.Add(std::move(conn));
+
+            return client_fd;
         }
 
         /**
@@ -111,12 +137,21 @@ namespace kvmemo::net
     private:
         void CreateSocket()
         {
-            listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
 
             if (listen_fd_ < 0)
             {
                 throw std::runtime_error("Failed to create socket");
             }
+
+            int enable = 1;
+            ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+            if (reuse_port_ &&
+                ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) < 0)
+            {
+                throw std::runtime_error("Failed to enable SO_REUSEPORT");
+            }
         }
 
         void Bind()
@@ -136,7 +171,7 @@ namespace kvmemo::net
 
         void Listen()
         {
-            if (::listen(listen_fd_, 128) < 0)
+            if (::listen(listen_fd_, SOMAXCONN) < 0)
             {
                 throw std::runtime_error("Listen Failed");
             }
@@ -144,6 +179,7 @@ namespace kvmemo::net
 
     private:
         int port_;
+        bool reuse_port_;
         int listen_fd_{-1};
 
         ConnectionManager connection_;
@@ -0,0 +1,222 @@
+#pragma once
+/**
+ * @file binary_framing.h
+ * @brief Length-prefixed binary request framing.
+ *
+ * Responsibilties :
+ * - Detect complete binary frames without scanning their payload.
+ * - Split a frame into command / argument views in O(1) per field.
+ * - Encode requests (for clients and tests) in the same format.
+ *
+ * -----------------------------------------------------------
+ *  REQUEST FRAME (all integers unsigned 32-bit big-endian) :  |
+ *    [body_len] [field_count] { [field_len] [field bytes] }   |
+ *  Field 0 is the command, the rest are arguments. Fields may |
+ *  contain any byte, including spaces, CR and LF.             |
+ * -----------------------------------------------------------
+ *
+ * Thread Safety :
+ *  > Thread-Safe
+ *  > Stateless utitlity class
+ *
+ *  Copyright © 2026
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "buffer.h"
+#include "request_view.h"
+
+namespace kvmemo::protocol
+{
+    /**
+     * @brief Frames and parses binary requests.
+     */
+    class BinaryFraming final
+    {
+    public:
+        BinaryFraming() = delete;
+        ~BinaryFraming() = delete;
+
+        BinaryFraming(const BinaryFraming &) = delete;
+        BinaryFraming &operator=(const BinaryFraming &) = delete;
+
+        /**
+         * @brief Size of the body length prefix.
+         */
+        static constexpr std::size_t kPrefixSize = sizeof(std::uint32_t);
+
+        /**
+         * @brief Largest accepted frame body; larger frames are rejected
+         *        before they are buffered.
+         */
+        static constexpr std::size_t kMaxBodyBytes = 64 * 1024 * 1024;
+
+        /**
+         * @brief Locates the next complete frame without copying it.
+         *
+         * @param body Set to the frame body (after the length prefix).
+         * @return false if more data is required.
+         *
+         * Throws std::invalid_argument if the announced body is too large.
+         */
+        static bool PeekFrame(const Buffer &buffer, std::string_view &body)
+        {
+            if (buffer.ReadableBytes() < kPrefixSize)
+            {
+                return false;
+            }
+
+            const std::size_t body_len = ReadU32(buffer.Data());
+
+            if (body_len > kMaxBodyBytes)
+            {
+                throw std::invalid_argument("Binary frame too large");
+            }
+
+            if (buffer.ReadableBytes() - kPrefixSize < body_len)
+            {
+                return false;
+            }
+
+            body = std::string_view(buffer.Data() + kPrefixSize, body_len);
+
+            return true;
+        }
+
+        /**
+         * @brief Total bytes (prefix included) occupied by @p body.
+         */
+        static std::size_t FrameSize(std::string_view body) noexcept
+        {
+            return kPrefixSize + body.size();
+        }
+
+        /**
+         * @brief Splits a frame body into a request; the views point into
+         *        @p body.
+         *
+         * Throws std::invalid_argument if the body is malformed.
+         */
+        static RequestView Parse(std::string_view body)
+        {
+            if (body.size() < sizeof(std::uint32_t))
+            {
+                throw std::invalid_argument("Malformed binary frame");
+            }
+
+            const std::uint32_t field_count = ReadU32(body.data());
+
+            if (field_count == 0)
+            {
+                throw std::invalid_argument("Empty command");
+            }
+
+            RequestView request;
+            std::size_t pos = sizeof(std::uint32_t);
+
+            for (std::uint32_t i = 0; i < field_count; ++i)
+            {
+                if (body.size() - pos < sizeof(std::uint32_t))
+                {
+                    throw std::invalid_argument("Malformed binary frame");
+                }
+
+                const std::size_t len = ReadU32(body.data() + pos);
+                pos += sizeof(std::uint32_t);
+
+                if (body.size() - pos < len)
+                {
+                    throw std::invalid_argument("Malformed binary frame");
+                }
+
+                const std::string_view field = body.substr(pos, len);
+                pos += len;
+
+                if (i == 0)
+                {
+                    request.SetCommand(field);
+                }
+                else
+                {
+                    request.AddArg(field);
+                }
+            }
+
+            if (pos != body.size() || request.Empty())
+            {
+                throw std::invalid_argument("Malformed binary frame");
+            }
+
+            return request;
+        }
+
+        /**
+         * @brief Encodes command and arguments as one binary frame.
+         */
+        template <typename... Fields>
+        static std::string Encode(std::string_view command, Fields... args)
+        {
+            const std::string_view fields[] = {command, std::string_view(args)...};
+
+            std::size_t body_len = sizeof(std::uint32_t);
+            for (const auto &field : fields)
+            {
+                body_len += sizeof(std::uint32_t) + field.size();
+            }
+
+            std::string frame;
+            frame.reserve(kPrefixSize + body_len);
+
+            AppendU32(frame, static_cast<std::uint32_t>(body_len));
+            AppendU32(frame, static_cast<std::uint32_t>(sizeof(fields) / sizeof(fields[0])));
+
+            for (const auto &field : fields)
+            {
+                AppendU32(frame, static_cast<std::uint32_t>(field.size()));
+                frame.append(field.data(), field.size());
+            }
+
+            return frame;
+        }
+
+        /**
+         * @brief Reads a big-endian 32-bit integer.
+         */
+        static std::uint32_t ReadU32(const char *data) noexcept
+        {
+            const auto *bytes = reinterpret_cast<const unsigned char *>(data);
+
+            return (static_cast<std::uint32_t>(bytes[0]) << 24) |
+                   (static_cast<std::uint32_t>(bytes[1]) << 16) |
+                   (static_cast<std::uint32_t>(bytes[2]) << 8) |
+                   static_cast<std::uint32_t>(bytes[3]);
+        }
+
+        /**
+         * @brief Appends a big-endian 32-bit integer.
+         */
+        static void AppendU32(std::string &out, std::uint32_t value)
+        {
+            const char bytes[4] = {
+                static_cast<char>(value >> 24),
+                static_cast<char>(value >> 16),
+                static_cast<char>(value >> 8),
+                static_cast<char>(value),
+            };
+
+            out.append(bytes, sizeof(bytes));
+        }
+    };
+} // namespace kvmemo::protocol
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
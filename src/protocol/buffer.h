@@ -24,6 +24,8 @@
 #include <cstring>
 #include <stdexcept>
 
+#include "../common/blob.h"
+
 namespace kvmemo::protocol {
 
 class Buffer final {
@@ -52,6 +54,13 @@ public:
         storage_.insert(storage_.end(), data.begin(), data.end());
     }
 
+    /**
+     * @brief Appends a copy of a shared value's bytes.
+     */
+    void Append(const common::Blob& data) {
+        Append(data.Data(), data.Size());
+    }
+
     /**
      * @brief Returns pointer to readable data.
      */
@@ -0,0 +1,182 @@
+#pragma once
+/**
+ * @file crlf_search.h
+ * @brief Vectorized search for the "\r\n" frame delimiter.
+ *
+ * Responsibilties :
+ * - Locate the first CRLF in a byte range, 16 / 32 bytes per step.
+ * - Pick the widest kernel the running CPU supports (AVX2, SSE2) once,
+ *   falling back to a scalar memchr loop on other architectures.
+ *
+ * Notes :
+ * > Every kernel compares each byte against '\n' and the byte before it
+ *   against '\r', so a match is always a complete delimiter and a search
+ *   may resume anywhere without missing a CRLF split across reads.
+ *
+ * Thread Safety :
+ *  > Thread-Safe
+ *  > Stateless utitlity class
+ *
+ *  Copyright © 2026
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KVMEMO_CRLF_X86 1
+#include <immintrin.h>
+#endif
+
+namespace kvmemo::protocol
+{
+    /**
+     * @brief CRLF search kernels and runtime dispatch.
+     */
+    class CrlfSearch final
+    {
+    public:
+        CrlfSearch() = delete;
+        ~CrlfSearch() = delete;
+
+        CrlfSearch(const CrlfSearch &) = delete;
+        CrlfSearch &operator=(const CrlfSearch &) = delete;
+
+        using Kernel = const char *(*)(const char *begin, const char *from, const char *end);
+
+        /**
+         * @brief Finds the first CRLF whose '\n' lies in [from, end).
+         *
+         * @param begin Start of the readable data; bytes before @p from are
+         *        only read to check for a preceding '\r'.
+         * @return Pointer to the '\r', or @p end if there is none.
+         */
+        static const char *Find(const char *begin, const char *from, const char *end) noexcept
+        {
+            static const Kernel kernel = Select();
+
+            return kernel(begin, from, end);
+        }
+
+        /**
+         * @brief Portable kernel: memchr for '\n', then check its neighbour.
+         */
+        static const char *FindScalar(const char *begin, const char *from, const char *end) noexcept
+        {
+            while (from < end)
+            {
+                const auto *lf = static_cast<const char *>(
+                    std::memchr(from, '\n', static_cast<std::size_t>(end - from)));
+
+                if (lf == nullptr)
+                {
+                    return end;
+                }
+
+                if (lf > begin && lf[-1] == '\r')
+                {
+                    return lf - 1;
+                }
+
+                from = lf + 1;
+            }
+
+            return end;
+        }
+
+#ifdef KVMEMO_CRLF_X86
+        /**
+         * @brief 16 bytes per step; SSE2 is part of the x86-64 baseline.
+         */
+        static const char *FindSse2(const char *begin, const char *from, const char *end) noexcept
+        {
+            // The first lane needs a readable predecessor.
+            if (from == begin && from < end)
+            {
+                ++from;
+            }
+
+            const __m128i cr = _mm_set1_epi8('\r');
+            const __m128i lf = _mm_set1_epi8('\n');
+
+            while (end - from >= 16)
+            {
+                const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+                const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from - 1));
+
+                const int mask = _mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(cur, lf), _mm_cmpeq_epi8(prev, cr)));
+
+                if (mask != 0)
+                {
+                    return from + __builtin_ctz(static_cast<unsigned>(mask)) - 1;
+                }
+
+                from += 16;
+            }
+
+            return FindScalar(begin, from, end);
+        }
+
+        /**
+         * @brief 32 bytes per step, used when the CPU reports AVX2.
+         */
+        __attribute__((target("avx2"))) static const char *FindAvx2(const char *begin,
+                                                                   const char *from,
+                                                                   const char *end) noexcept
+        {
+            if (from == begin && from < end)
+            {
+                ++from;
+            }
+
+            const __m256i cr = _mm256_set1_epi8('\r');
+            const __m256i lf = _mm256_set1_epi8('\n');
+
+            while (end - from >= 32)
+            {
+                const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from));
+                const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from - 1));
+
+                const int mask = _mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(cur, lf), _mm256_cmpeq_epi8(prev, cr)));
+
+                if (mask != 0)
+                {
+                    return from + __builtin_ctz(static_cast<unsigned>(mask)) - 1;
+                }
+
+                from += 32;
+            }
+
+            return FindSse2(begin, from, end);
+        }
+#endif
+
+        /**
+         * @brief Returns the kernel Find() dispatches to on this CPU.
+         */
+        static Kernel Select() noexcept
+        {
+#ifdef KVMEMO_CRLF_X86
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return &FindAvx2;
+            }
+
+            return &FindSse2;
+#else
+            return &FindScalar;
+#endif
+        }
+    };
+} // namespace kvmemo::protocol
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -6,7 +6,8 @@
  *  Responsibilities :
  *  - Identity complete command frames inside TCP byte stream
  *  - Extract command strings from protocol buffer.
- *  - Support incremental network reads.
+ *  - Support incremental network reads; a partial frame is never
+ *    rescanned from its start (see the scan offset of PeekFrame()).
  *
  *  Thread Safety :
  *  > Not Thread-Safe.
@@ -17,10 +18,13 @@
  *  ALL RIGHT RESERVED.
  */
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
-#include<algorithm>
+#include <string_view>
 
 #include "buffer.h"
+#include "crlf_search.h"
 
 namespace kvmemo::protocol
 {
@@ -48,31 +52,84 @@ namespace kvmemo::protocol
 
         static bool NextFrame(Buffer &buffer, std::string &frame)
         {
-            static constexpr char kDelimiter[] = "\r\n";
+            std::string_view view;
 
+            if (!PeekFrame(buffer, view))
+            {
+                return false;
+            }
+
+            frame.assign(view.data(), view.size());
+
+            ConsumeFrame(buffer, view);
+
+            return true;
+        }
+
+        /**
+         * @brief Locates the next complete frame without copying or
+         *        consuming it.
+         *
+         * @param frame Set to the frame (delimiter excluded); points into
+         *        @p buffer and stays valid until the buffer is consumed
+         *        or appended to.
+         *
+         * @return false if more data is required.
+         */
+        static bool PeekFrame(const Buffer &buffer, std::string_view &frame)
+        {
+            std::size_t scanned = 0;
+
+            return PeekFrame(buffer, frame, scanned);
+        }
+
+        /**
+         * @brief Resumable PeekFrame() for a buffer that grows between calls.
+         *
+         * @param scanned Bytes already known not to complete a delimiter.
+         *        Start at 0, keep the value across calls that return false
+         *        and reset it once the frame is consumed.
+         */
+        static bool PeekFrame(const Buffer &buffer, std::string_view &frame, std::size_t &scanned)
+        {
             const char *begin = buffer.Data();
             const char *end = begin + buffer.ReadableBytes();
 
-            const char *pos = std::search(
-                begin,
-                end,
-                std::begin(kDelimiter),
-                std::end(kDelimiter) - 1
-            );
+            const char *from = begin + std::min(scanned, buffer.ReadableBytes());
+
+            const char *pos = CrlfSearch::Find(begin, from, end);
 
             if (pos == end)
             {
+                scanned = buffer.ReadableBytes();
                 return false;
             }
 
-            std::size_t frame_len = pos - begin;
+            frame = std::string_view(begin, static_cast<std::size_t>(pos - begin));
 
-            frame.assign(begin, frame_len);
+            return true;
+        }
 
-            buffer.Consume(frame_len + 2);
+        /**
+         * @brief Total bytes (delimiter included) occupied by @p frame.
+         */
+        static std::size_t FrameSize(std::string_view frame) noexcept
+        {
+            return frame.size() + kDelimiterSize;
+        }
 
-            return true;
+        /**
+         * @brief Removes a frame returned by PeekFrame(), and its delimiter,
+         *        from the buffer.
+         */
+        static void ConsumeFrame(Buffer &buffer, std::string_view frame)
+        {
+            buffer.Consume(FrameSize(frame));
         }
+
+    private:
+        static constexpr char kDelimiter[] = "\r\n";
+        static constexpr std::size_t kDelimiterSize = sizeof(kDelimiter) - 1;
     };
 } // namespace kvmemo::protocol
 
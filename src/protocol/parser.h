@@ -5,7 +5,8 @@
  *  Responsibilities :
  *  - Parse raw client command strings.
  *  - Tokenize command and arguments.
- *  - Construct Request objects.
+ *  - Construct Request objects, or allocation-free RequestView objects
+ *    that borrow the input.
  *
  *  Thread Safety :
  *  > Thread-Safe.
@@ -16,11 +17,13 @@
  *  ALL RIGHTS RESERVED.
  */
 #include <string>
+#include <string_view>
 #include <vector>
 #include <sstream>
 #include <stdexcept>
 
 #include "request.h"
+#include "request_view.h"
 
 namespace kvmemo::protocol
 {
@@ -60,6 +63,65 @@ namespace kvmemo::protocol
 
             return Request(std::move(command), std::move(tokens));
         }
+
+        /**
+         * @brief Tokenizes @p input in place; the returned view points into
+         *        @p input and must not outlive it.
+         *
+         * Splits on the same whitespace as Parse().
+         * Throws std::invalid_argument if command is empty.
+         */
+        static RequestView ParseView(std::string_view input)
+        {
+            RequestView request;
+
+            std::size_t pos = 0;
+            bool first = true;
+
+            while (true)
+            {
+                while (pos < input.size() && IsSpace(input[pos]))
+                {
+                    ++pos;
+                }
+
+                if (pos == input.size())
+                {
+                    break;
+                }
+
+                const std::size_t start = pos;
+                while (pos < input.size() && !IsSpace(input[pos]))
+                {
+                    ++pos;
+                }
+
+                std::string_view token = input.substr(start, pos - start);
+
+                if (first)
+                {
+                    request.SetCommand(token);
+                    first = false;
+                }
+                else
+                {
+                    request.AddArg(token);
+                }
+            }
+
+            if (first)
+            {
+                throw std::invalid_argument("Empty command");
+            }
+
+            return request;
+        }
+
+    private:
+        static constexpr bool IsSpace(char c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+        }
     };
 } // namespace kvmemo::protocol
 
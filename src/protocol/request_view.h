@@ -0,0 +1,165 @@
+#pragma once
+/**
+ * @file request_view.h
+ * @brief Non-owning view of a parsed client request.
+ *
+ * Responsibilties :
+ * - Expose command and arguments as std::string_view tokens that point
+ *   into the connection's input Buffer.
+ * - Keep the common case allocation free (arguments stored inline).
+ *
+ * Lifetime :
+ * > Tokens are valid only until the frame they were parsed from is
+ *   consumed from the Buffer (see Framing::ConsumeFrame).
+ *
+ *  Thread Safety :
+ *  > Not Thread-safe.
+ *  > Each view is used by a single event-loop thread.
+ *
+ *  Copyright © 2026
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "request.h"
+
+namespace kvmemo::protocol
+{
+    /**
+     * @brief Parsed command whose tokens borrow the frame's memory.
+     */
+    class RequestView final
+    {
+    public:
+        /**
+         * @brief Arguments stored without a heap allocation.
+         */
+        static constexpr std::size_t kInlineArgs = 6;
+
+        RequestView() = default;
+
+        /**
+         * @brief Borrows the tokens of an owning Request.
+         */
+        explicit RequestView(const Request &request) : command_(request.Command())
+        {
+            for (const auto &arg : request.Args())
+            {
+                AddArg(arg);
+            }
+        }
+
+        RequestView(const RequestView &) = default;
+        RequestView &operator=(const RequestView &) = default;
+
+        RequestView(RequestView &&) noexcept = default;
+        RequestView &operator=(RequestView &&) noexcept = default;
+
+        ~RequestView() = default;
+
+        /**
+         * @brief Returns command name.
+         */
+        std::string_view Command() const noexcept
+        {
+            return command_;
+        }
+
+        /**
+         * @brief Case-insensitive command comparison (@p name upper case),
+         *        as Redis clients may send commands in either case.
+         */
+        bool CommandIs(std::string_view name) const noexcept
+        {
+            if (command_.size() != name.size())
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < name.size(); ++i)
+            {
+                char c = command_[i];
+                if (c >= 'a' && c <= 'z')
+                {
+                    c = static_cast<char>(c - 'a' + 'A');
+                }
+
+                if (c != name[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void SetCommand(std::string_view command) noexcept
+        {
+            command_ = command;
+        }
+
+        /**
+         * @brief Returns number of arguments.
+         */
+        std::size_t ArgCount() const noexcept
+        {
+            return arg_count_;
+        }
+
+        /**
+         * @brief Returns argument at index.
+         * Throws std::out_of_range if index invalid.
+         */
+        std::string_view Arg(std::size_t index) const
+        {
+            if (index >= arg_count_)
+            {
+                throw std::out_of_range("Request argument index out range");
+            }
+
+            return index < kInlineArgs ? inline_args_[index] : overflow_args_[index - kInlineArgs];
+        }
+
+        /**
+         * @brief Appends an argument token.
+         */
+        void AddArg(std::string_view arg)
+        {
+            if (arg_count_ < kInlineArgs)
+            {
+                inline_args_[arg_count_] = arg;
+            }
+            else
+            {
+                overflow_args_.push_back(arg);
+            }
+
+            ++arg_count_;
+        }
+
+        /**
+         * @brief Checks if request is empty.
+         */
+        bool Empty() const noexcept
+        {
+            return command_.empty();
+        }
+
+    private:
+        std::string_view command_;
+        std::array<std::string_view, kInlineArgs> inline_args_{};
+        std::vector<std::string_view> overflow_args_;
+        std::size_t arg_count_{0};
+    };
+} // namespace kvmemo::protocol
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
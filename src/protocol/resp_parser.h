@@ -0,0 +1,188 @@
+#pragma once
+/**
+ * @file resp_parser.h
+ * @brief Parses RESP2 multibulk requests, as sent by Redis clients.
+ *
+ * Responsibilties :
+ * - Detect complete "*<n>\r\n$<len>\r\n<bytes>\r\n..." requests.
+ * - Split them into command / argument views without copying.
+ *
+ * Notes :
+ * > Bulk payloads are length delimited, so only the short length lines
+ *   are scanned and payloads may contain any byte.
+ * > An incomplete request leaves the buffer untouched; parsing starts
+ *   over once more data has arrived.
+ *
+ * Thread Safety :
+ *  > Thread-Safe
+ *  > Stateless utitlity class
+ *
+ *  Copyright © 2026
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "buffer.h"
+#include "request_view.h"
+
+namespace kvmemo::protocol
+{
+    /**
+     * @brief RESP2 multibulk request parser.
+     */
+    class RespParser final
+    {
+    public:
+        RespParser() = delete;
+        ~RespParser() = delete;
+
+        RespParser(const RespParser &) = delete;
+        RespParser &operator=(const RespParser &) = delete;
+
+        /**
+         * @brief Largest accepted argument count and bulk length.
+         */
+        static constexpr std::size_t kMaxArgs = 1024 * 1024;
+        static constexpr std::size_t kMaxBulkBytes = 64 * 1024 * 1024;
+
+        /**
+         * @brief Returns true if @p buffer starts with a multibulk request.
+         */
+        static bool IsMultiBulk(const Buffer &buffer) noexcept
+        {
+            return buffer.ReadableBytes() > 0 && buffer.Data()[0] == '*';
+        }
+
+        /**
+         * @brief Parses the multibulk request at the front of @p buffer.
+         *
+         * @param request Views into @p buffer.
+         * @param frame_bytes Bytes the request occupies.
+         * @return false if more data is required.
+         *
+         * Throws std::invalid_argument on a malformed request.
+         */
+        static bool PeekRequest(const Buffer &buffer, RequestView &request, std::size_t &frame_bytes)
+        {
+            const std::string_view input(buffer.Data(), buffer.ReadableBytes());
+            std::size_t pos = 0;
+            std::size_t count = 0;
+
+            if (!ReadLength(input, pos, '*', kMaxArgs, count))
+            {
+                return false;
+            }
+
+            if (count == 0)
+            {
+                throw std::invalid_argument("Empty command");
+            }
+
+            RequestView parsed;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::size_t len = 0;
+
+                if (!ReadLength(input, pos, '$', kMaxBulkBytes, len))
+                {
+                    return false;
+                }
+
+                if (input.size() - pos < len + 2)
+                {
+                    return false;
+                }
+
+                if (input[pos + len] != '\r' || input[pos + len + 1] != '\n')
+                {
+                    throw std::invalid_argument("Malformed RESP bulk string");
+                }
+
+                const std::string_view field = input.substr(pos, len);
+                pos += len + 2;
+
+                if (i == 0)
+                {
+                    parsed.SetCommand(field);
+                }
+                else
+                {
+                    parsed.AddArg(field);
+                }
+            }
+
+            if (parsed.Empty())
+            {
+                throw std::invalid_argument("Empty command");
+            }
+
+            request = std::move(parsed);
+            frame_bytes = pos;
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Reads "<prefix><digits>\r\n" at @p pos.
+         *
+         * @return false if the line is not complete yet.
+         */
+        static bool ReadLength(std::string_view input,
+                               std::size_t &pos,
+                               char prefix,
+                               std::size_t max,
+                               std::size_t &value)
+        {
+            if (pos >= input.size())
+            {
+                return false;
+            }
+
+            if (input[pos] != prefix)
+            {
+                throw std::invalid_argument("Malformed RESP request");
+            }
+
+            std::size_t cursor = pos + 1;
+            std::size_t parsed = 0;
+            std::size_t digits = 0;
+
+            while (cursor < input.size() && input[cursor] >= '0' && input[cursor] <= '9')
+            {
+                parsed = parsed * 10 + static_cast<std::size_t>(input[cursor] - '0');
+                ++digits;
+                ++cursor;
+
+                if (parsed > max)
+                {
+                    throw std::invalid_argument("RESP length out of range");
+                }
+            }
+
+            if (input.size() - cursor < 2)
+            {
+                return false;
+            }
+
+            if (digits == 0 || input[cursor] != '\r' || input[cursor + 1] != '\n')
+            {
+                throw std::invalid_argument("Malformed RESP length");
+            }
+
+            value = parsed;
+            pos = cursor + 2;
+            return true;
+        }
+    };
+} // namespace kvmemo::protocol
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
@@ -7,6 +7,8 @@
  * - Represent the result of a command execution.
  * - Store response status (OK / ERROR).
  * - Store optional payload data returned to client.
+ * - Carry a stored value as a shared Blob so it reaches the output
+ *   queue without being copied.
  *
  * Thread Safety :
  * > Not thread-safe.
@@ -17,9 +19,12 @@
  *  ALL RIGHTS RESERVED.
  */
 
+#include <cstdint>
 #include <string>
 #include <utility>
 
+#include "../common/blob.h"
+
 namespace kvmemo::protocol
 {
     /**
@@ -31,6 +36,20 @@ namespace kvmemo::protocol
         Error
     };
 
+    /**
+     * @brief Shape of the reply for dialects that can express it (RESP).
+     *
+     * Dialects without a dedicated encoding fall back to the status and
+     * message, which keeps the text protocol's replies unchanged.
+     */
+    enum class ResponseType : std::uint8_t
+    {
+        Default,
+        Null,
+        Integer,
+        Value // a stored value, possibly empty
+    };
+
     /**
      * @brief Represents a protocol response sent to client.
      */
@@ -60,6 +79,19 @@ namespace kvmemo::protocol
             return Response(ResponseStatus::Ok, std::move(message));
         }
 
+        /**
+         * @brief Creates a success response whose payload is @p value.
+         *        Serialized like Ok(message) with the same bytes, except
+         *        that an empty value is still sent as a value, not as OK.
+         */
+        static Response Value(common::Blob value)
+        {
+            Response response(ResponseStatus::Ok);
+            response.type_ = ResponseType::Value;
+            response.value_ = std::move(value);
+            return response;
+        }
+
         /**
          * @brief Creates error response.
          */
@@ -68,6 +100,28 @@ namespace kvmemo::protocol
             return Response(ResponseStatus::Error, std::move(message));
         }
 
+        /**
+         * @brief Creates a "no value" response. Text clients see an error
+         *        carrying @p message; RESP clients see a null bulk string.
+         */
+        static Response Null(std::string message)
+        {
+            Response response(ResponseStatus::Error, std::move(message));
+            response.type_ = ResponseType::Null;
+            return response;
+        }
+
+        /**
+         * @brief Creates an integer response (a decimal payload in the text
+         *        protocol).
+         */
+        static Response Integer(std::int64_t value)
+        {
+            Response response(ResponseStatus::Ok, std::to_string(value));
+            response.type_ = ResponseType::Integer;
+            return response;
+        }
+
         /**
          * @brief Returns response status.
          */
@@ -76,6 +130,14 @@ namespace kvmemo::protocol
             return status_;
         }
 
+        /**
+         * @brief Returns response type.
+         */
+        ResponseType Type() const noexcept
+        {
+            return type_;
+        }
+
         /**
          * @brief Returns response message payload.
          */
@@ -84,6 +146,30 @@ namespace kvmemo::protocol
             return message_;
         }
 
+        /**
+         * @brief Moves the payload out, leaving the message empty.
+         */
+        std::string ReleaseMessage() noexcept
+        {
+            return std::move(message_);
+        }
+
+        /**
+         * @brief Returns the shared payload set by Value() (empty if none).
+         */
+        const common::Blob &SharedValue() const noexcept
+        {
+            return value_;
+        }
+
+        /**
+         * @brief Moves the shared payload out.
+         */
+        common::Blob ReleaseSharedValue() noexcept
+        {
+            return std::move(value_);
+        }
+
         /**
          * @brief Check if response indicates success.
          */
@@ -102,7 +188,9 @@ namespace kvmemo::protocol
 
     private:
         ResponseStatus status_{ResponseStatus::Ok};
+        ResponseType type_{ResponseType::Default};
         std::string message_;
+        common::Blob value_;
     };
 } // namespace kvmemo::protocol
 
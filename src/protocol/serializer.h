@@ -15,6 +15,19 @@
  *  - Error         => -Err key not found\r\n |
  * -------------------------------------------
  *
+ * --------------------------------------------------------
+ *  BINARY WIRE FORMAT (negotiated, see binary_framing.h) :  |
+ *  - [u8 type] [u32 big-endian length] [payload]            |
+ *  - type '+' : success without payload                      |
+ *  - type '$' : success with payload                         |
+ *  - type '-' : error, payload is the message                |
+ *  - type '_' : no value (e.g. GET miss), empty payload      |
+ *  - type ':' : integer, payload is its decimal form         |
+ * --------------------------------------------------------
+ *
+ * RESP2 replies (connections that sent a multibulk request) use null
+ * bulk strings ($-1) and integers (:n) and the "-ERR <message>" form.
+ *
  * Thread Safety :
  *  > Thread-Safe
  *  > Stateless utitlity class
@@ -24,15 +37,27 @@
  *  ALL RIGHTS RESERVED.
  */
 
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <sstream>
+#include <string_view>
+#include <utility>
 
+#include "../common/blob.h"
 #include "response.h"
 
 namespace kvmemo::protocol
 {
     /**
      * @brief Converts Response objects into protocol wire format.
+     *
+     * The Append* functions write a reply straight into any sink exposing
+     * Append(const char*, size_t), Append(std::string&&) and
+     * Append(common::Blob&&) (Buffer, net::OutputQueue): headers are
+     * formatted on the stack with std::to_chars and the payload is moved
+     * into the sink. The string returning functions are conveniences
+     * built on top of them.
      */
     class Serializer final
     {
@@ -44,46 +69,249 @@ namespace kvmemo::protocol
         Serializer &operator=(const Serializer &) = delete;
 
         /**
-         * @brief Serializes response into protocol string.
+         * @brief Pre-encoded constant replies.
          */
-        static std::string Serialize(const Response &response)
+        static constexpr std::string_view kOkReply = "+OK\r\n";
+        static constexpr std::string_view kRespNullReply = "$-1\r\n";
+
+        /**
+         * @brief Appends @p response in the text wire format.
+         */
+        template <typename Sink>
+        static void AppendText(Response &&response, Sink &out)
         {
             if (response.IsError())
             {
-                return SerializeError(response.Message());
+                AppendRaw(out, "-ERR");
+                AppendPayload(out, response.ReleaseMessage());
+                AppendRaw(out, kCrlf);
+                return;
+            }
+
+            if (response.Type() == ResponseType::Value)
+            {
+                AppendBulkString(out, response.ReleaseSharedValue());
+                return;
             }
 
             if (response.Message().empty())
             {
-                return "+OK\r\n";
+                AppendRaw(out, kOkReply);
+                return;
             }
 
-            return SerializeBulkString(response.Message());
+            AppendBulkString(out, response.ReleaseMessage());
+        }
+
+        /**
+         * @brief Appends @p response in the binary reply format.
+         */
+        template <typename Sink>
+        static void AppendBinary(Response &&response, Sink &out)
+        {
+            char type = '$';
+
+            if (response.Type() == ResponseType::Null)
+            {
+                type = '_';
+            }
+            else if (response.Type() == ResponseType::Integer)
+            {
+                type = ':';
+            }
+            else if (response.IsError())
+            {
+                type = '-';
+            }
+            else if (response.Type() != ResponseType::Value && response.Message().empty())
+            {
+                type = '+';
+            }
+
+            if (response.Type() == ResponseType::Value)
+            {
+                common::Blob value = response.ReleaseSharedValue();
+                AppendBinaryHeader(out, type, value.Size());
+                AppendPayload(out, std::move(value));
+                return;
+            }
+
+            std::string payload = type == '_' ? std::string() : response.ReleaseMessage();
+            AppendBinaryHeader(out, type, payload.size());
+            AppendPayload(out, std::move(payload));
+        }
+
+
+        /**
+         * @brief Appends @p response as a RESP2 reply.
+         */
+        template <typename Sink>
+        static void AppendResp(Response &&response, Sink &out)
+        {
+            switch (response.Type())
+            {
+            case ResponseType::Null:
+                AppendRaw(out, kRespNullReply);
+                return;
+
+            case ResponseType::Integer:
+                AppendRaw(out, ":");
+                AppendRaw(out, response.Message());
+                AppendRaw(out, kCrlf);
+                return;
+
+            case ResponseType::Default:
+            case ResponseType::Value:
+                break;
+            }
+
+            if (response.IsError())
+            {
+                AppendRaw(out, "-ERR ");
+                AppendPayload(out, response.ReleaseMessage());
+                AppendRaw(out, kCrlf);
+                return;
+            }
+
+            AppendText(std::move(response), out);
+        }
+
+        /**
+         * @brief Serializes response into protocol string.
+         */
+        static std::string Serialize(const Response &response)
+        {
+            std::string out;
+            StringSink sink{out};
+            AppendText(Response(response), sink);
+
+            return out;
+        }
+
+        /**
+         * @brief Serializes response into the binary reply format.
+         */
+        static std::string SerializeBinary(const Response &response)
+        {
+            std::string out;
+            StringSink sink{out};
+            AppendBinary(Response(response), sink);
+
+            return out;
+        }
+
+        /**
+         * @brief Serializes response as a RESP2 reply.
+         */
+        static std::string SerializeResp(const Response &response)
+        {
+            std::string out;
+            StringSink sink{out};
+            AppendResp(Response(response), sink);
+
+            return out;
         }
 
     private:
+        static constexpr std::string_view kCrlf = "\r\n";
+
+        /**
+         * @brief Adapts std::string to the sink interface.
+         */
+        struct StringSink
+        {
+            std::string &out;
+
+            void Append(const char *data, std::size_t len)
+            {
+                out.append(data, len);
+            }
+
+            void Append(std::string &&data)
+            {
+                out.append(data);
+            }
+
+            void Append(common::Blob &&data)
+            {
+                out.append(data.View());
+            }
+        };
+
+        template <typename Sink>
+        static void AppendRaw(Sink &out, std::string_view bytes)
+        {
+            out.Append(bytes.data(), bytes.size());
+        }
+
+        template <typename Sink>
+        static void AppendPayload(Sink &out, std::string &&payload)
+        {
+            if (!payload.empty())
+            {
+                out.Append(std::move(payload));
+            }
+        }
+
+        template <typename Sink>
+        static void AppendPayload(Sink &out, common::Blob &&payload)
+        {
+            if (!payload.Empty())
+            {
+                out.Append(std::move(payload));
+            }
+        }
+
         /**
-         * @brief Serializes bulk string response.
+         * @brief Appends the 5-byte binary reply header: type, then the
+         *        payload length as big-endian uint32.
          */
-        static std::string SerializeBulkString(const std::string &value)
+        template <typename Sink>
+        static void AppendBinaryHeader(Sink &out, char type, std::size_t size)
         {
-            std::ostringstream ss;
-            ss << "$" << value.size() << "\r\n";
-            ss << value << "\r\n";
+            const auto len = static_cast<std::uint32_t>(size);
+
+            const char header[5] = {
+                type,
+                static_cast<char>(len >> 24),
+                static_cast<char>(len >> 16),
+                static_cast<char>(len >> 8),
+                static_cast<char>(len),
+            };
 
-            return ss.str();
+            out.Append(header, sizeof(header));
         }
 
         /**
-         * @brief Serializes error response.
+         * @brief Appends "$<len>\r\n<value>\r\n".
          */
-        static std::string SerializeError(const std::string &message)
+        template <typename Sink>
+        static void AppendBulkString(Sink &out, std::string &&value)
+        {
+            AppendBulkHeader(out, value.size());
+            AppendPayload(out, std::move(value));
+            AppendRaw(out, kCrlf);
+        }
+
+        template <typename Sink>
+        static void AppendBulkString(Sink &out, common::Blob &&value)
+        {
+            AppendBulkHeader(out, value.Size());
+            AppendPayload(out, std::move(value));
+            AppendRaw(out, kCrlf);
+        }
+
+        template <typename Sink>
+        static void AppendBulkHeader(Sink &out, std::size_t size)
         {
-            std::ostringstream ss;
+            char header[24];
+            header[0] = '$';
 
-            ss << "-ERR" << message << "\r\n";
+            char *end = std::to_chars(header + 1, header + sizeof(header) - 2, size).ptr;
+            *end++ = '\r';
+            *end++ = '\n';
 
-            return ss.str();
+            out.Append(header, static_cast<std::size_t>(end - header));
         }
     };
 } // namespace kvmemo::protocol
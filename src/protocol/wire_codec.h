@@ -0,0 +1,150 @@
+#pragma once
+/**
+ * @file wire_codec.h
+ * @brief Per-connection choice of request framing and reply encoding.
+ *
+ * Responsibilties :
+ * - Map a connection's negotiated WireFormat to the matching framing,
+ *   parser and serializer.
+ *
+ * Negotiation :
+ * > Every connection starts in kText. The command "PROTOCOL BINARY"
+ *   (answered in the current format) switches all following requests and
+ *   replies to kBinary; "PROTOCOL TEXT" switches back.
+ * > A text connection that sends a RESP multibulk request ('*' first)
+ *   becomes kResp, like a Redis client: it may still send inline
+ *   commands, and every reply from then on is RESP2.
+ *
+ * Thread Safety :
+ *  > Thread-Safe
+ *  > Stateless utitlity class
+ *
+ *  Copyright © 2026
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "binary_framing.h"
+#include "buffer.h"
+#include "framing.h"
+#include "parser.h"
+#include "request_view.h"
+#include "resp_parser.h"
+#include "response.h"
+#include "serializer.h"
+
+namespace kvmemo::protocol
+{
+    /**
+     * @brief Wire format spoken on a connection.
+     */
+    enum class WireFormat : std::uint8_t
+    {
+        kText = 0,   // whitespace separated, CRLF terminated lines
+        kBinary = 1, // length-prefixed fields, see binary_framing.h
+        kResp = 2,   // RESP2 multibulk or inline requests, RESP2 replies
+    };
+
+    /**
+     * @brief Format-dispatching front end over Framing / Parser / Serializer.
+     */
+    class WireCodec final
+    {
+    public:
+        WireCodec() = delete;
+        ~WireCodec() = delete;
+
+        WireCodec(const WireCodec &) = delete;
+        WireCodec &operator=(const WireCodec &) = delete;
+
+        /**
+         * @brief Parses the next complete request in place.
+         *
+         * @param format Connection format; kText is upgraded to kResp when
+         *        a multibulk request arrives.
+         * @param request Views into @p buffer, valid until @p frame_bytes
+         *        are consumed from it.
+         * @param frame_bytes Bytes to consume once the request is handled.
+         * @param scanned Text framing scan offset (see Framing::PeekFrame);
+         *        reset it whenever a request is consumed.
+         * @return false if more data is required.
+         *
+         * Throws std::invalid_argument on a malformed request.
+         */
+        static bool PeekRequest(WireFormat &format,
+                                const Buffer &buffer,
+                                RequestView &request,
+                                std::size_t &frame_bytes,
+                                std::size_t &scanned)
+        {
+            std::string_view frame;
+
+            if (format == WireFormat::kBinary)
+            {
+                if (!BinaryFraming::PeekFrame(buffer, frame))
+                {
+                    return false;
+                }
+
+                request = BinaryFraming::Parse(frame);
+                frame_bytes = BinaryFraming::FrameSize(frame);
+                return true;
+            }
+
+            if (RespParser::IsMultiBulk(buffer))
+            {
+                if (!RespParser::PeekRequest(buffer, request, frame_bytes))
+                {
+                    return false;
+                }
+
+                format = WireFormat::kResp;
+                return true;
+            }
+
+            if (!Framing::PeekFrame(buffer, frame, scanned))
+            {
+                return false;
+            }
+
+            request = Parser::ParseView(frame);
+            frame_bytes = Framing::FrameSize(frame);
+            return true;
+        }
+
+        /**
+         * @brief Appends a reply in @p format to @p out (see Serializer for
+         *        the sink interface); the response's payload is moved.
+         */
+        template <typename Sink>
+        static void AppendReply(WireFormat format, Response &&response, Sink &out)
+        {
+            switch (format)
+            {
+            case WireFormat::kBinary:
+                Serializer::AppendBinary(std::move(response), out);
+                return;
+
+            case WireFormat::kResp:
+                Serializer::AppendResp(std::move(response), out);
+                return;
+
+            case WireFormat::kText:
+                break;
+            }
+
+            Serializer::AppendText(std::move(response), out);
+        }
+    };
+} // namespace kvmemo::protocol
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
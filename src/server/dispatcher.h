@@ -18,10 +18,13 @@
  */
 
 #include <string>
+#include <string_view>
 #include <optional>
 #include <stdexcept>
+#include <utility>
 
 #include "../protocol/request.h"
+#include "../protocol/request_view.h"
 #include "../protocol/response.h"
 #include "../core/kv_engine.h"
 
@@ -47,50 +50,58 @@ namespace kvmemo::server
          * @brief Dispatch request to correct engine command.
          */
         protocol::Response Dispatch(const protocol::Request &request)
+        {
+            return Dispatch(protocol::RequestView(request));
+        }
+
+        /**
+         * @brief Dispatch a request parsed in place from the input buffer.
+         *
+         * Keys and values are copied only where the engine stores them.
+         */
+        protocol::Response Dispatch(const protocol::RequestView &request)
         {
             if (request.Empty())
             {
                 return protocol::Response::Error("Empty Command");
             }
 
-            const std::string &cmd = request.Command();
-
-            if (cmd == "SET")
+            if (request.CommandIs("SET"))
             {
                 return HandleSet(request);
             }
 
-            if (cmd == "GET")
+            if (request.CommandIs("GET"))
             {
                 return HandleGet(request);
             }
 
-            if (cmd == "DEL")
+            if (request.CommandIs("DEL"))
             {
                 return HandleDelete(request);
             }
 
-            if (cmd == "SETEX")
+            if (request.CommandIs("SETEX"))
             {
                 return HandleSetEx(request);
             }
 
-            if (cmd == "KEYS")
+            if (request.CommandIs("KEYS"))
             {
                 return HandleKeys(request);
             }
 
-            if (cmd == "PING")
+            if (request.CommandIs("PING"))
             {
                 return HandlePing(request);
             }
 
-            if (cmd == "FLUSH")
+            if (request.CommandIs("FLUSH"))
             {
                 return HandleFlush(request);
             }
 
-            if (cmd == "EXISTS")
+            if (request.CommandIs("EXISTS"))
             {
                 return HandleExists(request);
             }
@@ -99,64 +110,73 @@ namespace kvmemo::server
         }
 
     private:
-        protocol::Response HandleSet(const protocol::Request &req)
+        static protocol::Response OutOfMemory()
+        {
+            return protocol::Response::Error("OOM command not allowed when used memory > 'max_memory_bytes'");
+        }
+
+        /**
+         * @brief Reply to a SET or SETEX from the engine's result.
+         */
+        static protocol::Response SetReply(core::SetResult result)
+        {
+            switch (result)
+            {
+            case core::SetResult::kOutOfMemory:
+                return OutOfMemory();
+            case core::SetResult::kNotAdmitted:
+                return protocol::Response::Error("Key not stored: refused by the eviction policy under memory pressure");
+            case core::SetResult::kStored:
+                break;
+            }
+            return protocol::Response::Ok();
+        }
+
+        protocol::Response HandleSet(const protocol::RequestView &req)
         {
             if (req.ArgCount() < 2)
             {
                 return protocol::Response::Error("SET requires key and value");
             }
 
-            const std::string &key = req.Arg(0);
-            const std::string &value = req.Arg(1);
-
-            engine_.Set(key, value);
-
-            return protocol::Response::Ok();
+            return SetReply(engine_.Set(req.Arg(0), req.Arg(1)));
         }
 
-        protocol::Response HandleGet(const protocol::Request &req)
+        protocol::Response HandleGet(const protocol::RequestView &req)
         {
             if (req.ArgCount() < 1)
             {
                 return protocol::Response::Error("Get requires key");
             }
 
-            const std::string &key = req.Arg(0);
-
-            auto value = engine_.Get(key);
+            auto value = engine_.GetShared(req.Arg(0));
 
             if (!value.has_value())
             {
-                return protocol::Response::Error("Key not found");
+                return protocol::Response::Null("Key not found");
             }
 
-            return protocol::Response::Ok(value.value());
+            return protocol::Response::Value(std::move(*value));
         }
 
-        protocol::Response HandleDelete(const protocol::Request &req)
+        protocol::Response HandleDelete(const protocol::RequestView &req)
         {
             if (req.ArgCount() < 1)
             {
                 return protocol::Response::Error("DEL requires key");
             }
 
-            const std::string &key = req.Arg(0);
-
-            engine_.Delete(key);
-
-            return protocol::Response::Ok();
+            return protocol::Response::Integer(engine_.Delete(req.Arg(0)) ? 1 : 0);
         }
 
-        protocol::Response HandleSetEx(const protocol::Request &req)
+        protocol::Response HandleSetEx(const protocol::RequestView &req)
         {
             if (req.ArgCount() < 3)
             {
                 return protocol::Response::Error("SETEX requires key, ttl_ms and value");
             }
 
-            const std::string &key = req.Arg(0);
-            const std::string &ttl_str = req.Arg(1);
-            const std::string &value = req.Arg(2);
+            const std::string ttl_str(req.Arg(1));
 
             uint64_t ttl_ms = 0;
             try
@@ -177,15 +197,13 @@ namespace kvmemo::server
                 return protocol::Response::Error("SETEX ttl_ms must be a valid integer");
             }
 
-            engine_.Set(key, value, ttl_ms);
-
-            return protocol::Response::Ok();
+            return SetReply(engine_.Set(req.Arg(0), req.Arg(2), ttl_ms));
         }
 
         /**
          * @brief Handles the KEYS command — returns all key:value pairs.
          */
-        protocol::Response HandleKeys(const protocol::Request &req)
+        protocol::Response HandleKeys(const protocol::RequestView &req)
         {
             if (req.ArgCount() > 0)
             {
@@ -212,7 +230,7 @@ namespace kvmemo::server
         /**
          * @brief Handles PING health check command.
          */
-        protocol::Response HandlePing(const protocol::Request &req)
+        protocol::Response HandlePing(const protocol::RequestView &req)
         {
             if (req.ArgCount() > 0)
             {
@@ -224,7 +242,7 @@ namespace kvmemo::server
         /**
          * @brief Handles FLUSH — deletes all keys and resets TTL index and memory tracker.
          */
-        protocol::Response HandleFlush(const protocol::Request &req)
+        protocol::Response HandleFlush(const protocol::RequestView &req)
         {
             if (req.ArgCount() > 0)
             {
@@ -236,14 +254,14 @@ namespace kvmemo::server
         /**
          * @brief Handles EXISTS — checks if a key exists (expired keys return 0).
          */
-        protocol::Response HandleExists(const protocol::Request &req)
+        protocol::Response HandleExists(const protocol::RequestView &req)
         {
             if (req.ArgCount() < 1)
             {
                 return protocol::Response::Error("EXISTS requires key");
             }
-            auto value = engine_.Get(req.Arg(0));
-            return protocol::Response::Ok(value.has_value() ? "1" : "0");
+            auto value = engine_.GetShared(req.Arg(0));
+            return protocol::Response::Integer(value.has_value() ? 1 : 0);
         }
 
     private:
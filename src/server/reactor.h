@@ -0,0 +1,777 @@
+#pragma once
+/**
+ * @file reactor.h
+ * @brief One event-loop thread's worth of networking.
+ *
+ * Responsibilities :
+ * - Own a listening socket, an EventLoop and a ConnectionManager.
+ * - Accept, read, frame, dispatch and write for its own connections.
+ * - Enforce the server-wide connection limit on accept.
+ *
+ * Several reactors bind the same port with SO_REUSEPORT; the kernel then
+ * spreads incoming connections across them, and a connection stays on the
+ * reactor that accepted it for its whole lifetime.
+ *
+ * I/O backends :
+ * > epoll (default) : edge-triggered readiness, one read()/send() per
+ *   drained socket.
+ * > io_uring (Config::io_backend, KVMEMO_ENABLE_IO_URING builds) :
+ *   multishot accept and multishot recv into kernel-provided buffers;
+ *   all sends and re-arms queued while handling one batch of
+ *   completions are submitted together with a single io_uring_enter().
+ *   Falls back to epoll if the kernel cannot provide the ring.
+ *
+ * Thread Safety :
+ * > Not thread-safe; Run() is driven by exactly one thread.
+ * > Stop() may be called from any thread.
+ * > Shares only the (thread-safe) Dispatcher / KVEngine with other reactors.
+ *
+ *  Copyright © 2026 KVMemo
+ *  Author: Gagan Bansal
+ *  ALL RIGHTS RESERVED.
+ */
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../common/config.h"
+#include "../common/logger.h"
+#include "../net/event_loop.h"
+#include "../net/io_uring.h"
+#include "../net/tcp_server.h"
+#include "../protocol/response.h"
+#include "../protocol/wire_codec.h"
+#include "dispatcher.h"
+
+namespace kvmemo::server
+{
+    /**
+     * @brief Single-threaded accept/read/dispatch/write loop.
+     */
+    class Reactor final
+    {
+    public:
+        /**
+         * @param config Server configuration (port, limits, I/O backend).
+         * @param reuse_port Bind with SO_REUSEPORT (required when more than
+         *        one reactor listens on the same port).
+         * @param dispatcher Shared command dispatcher.
+         * @param active_connections Server-wide open connection counter.
+         */
+        Reactor(const common::Config &config,
+                bool reuse_port,
+                Dispatcher &dispatcher,
+                std::atomic<std::size_t> &active_connections)
+            : server_(config.listen_port, reuse_port),
+              dispatcher_(dispatcher),
+              active_connections_(active_connections),
+              max_connections_(config.max_connections),
+              max_output_buffer_bytes_(config.max_output_buffer_bytes),
+              io_backend_(config.io_backend) {}
+
+        Reactor(const Reactor &) = delete;
+        Reactor &operator=(const Reactor &) = delete;
+
+        Reactor(Reactor &&) = delete;
+        Reactor &operator=(Reactor &&) = delete;
+
+        ~Reactor() = default;
+
+        /**
+         * @brief Binds and listens. Called before Run() so that bind errors
+         *        surface on the thread that starts the server.
+         */
+        void Start()
+        {
+            server_.Start();
+            loop_.Add(server_.ListenFD(), net::EventLoop::kReadable);
+        }
+
+        /**
+         * @brief Runs the event loop until Stop() is called.
+         */
+        void Run()
+        {
+#if defined(KVMEMO_WITH_IO_URING)
+            if (io_backend_ == common::IoBackend::kIoUring)
+            {
+                auto ring = CreateRing();
+                if (ring)
+                {
+                    RunIoUring(*ring);
+                    return;
+                }
+            }
+#else
+            if (io_backend_ == common::IoBackend::kIoUring)
+            {
+                KV_LOG_WARN("io_uring backend not compiled in; using epoll");
+            }
+#endif
+
+            while (!stop_.load(std::memory_order_acquire))
+            {
+                ProcessEvents();
+            }
+        }
+
+        /**
+         * @brief Asks the loop to exit and wakes it if it is blocked.
+         */
+        void Stop() noexcept
+        {
+            stop_.store(true, std::memory_order_release);
+            loop_.Wakeup();
+        }
+
+    private:
+        /**
+         * @brief Waits for readiness on the listening socket and the client
+         *        sockets, then handles only the descriptors that are ready.
+         *
+         *        All sockets are non-blocking and edge-triggered, so the loop
+         *        blocks in epoll until there is work instead of polling, and
+         *        each handler drains its socket before returning.
+         */
+        void ProcessEvents()
+        {
+            auto &manager = server_.Connection();
+            const int listen_fd = server_.ListenFD();
+
+            loop_.Poll(net::EventLoop::kNoTimeout, [&](int fd, std::uint32_t events)
+                       {
+                if (fd == listen_fd)
+                {
+                    AcceptConnections();
+                    return;
+                }
+
+                HandleConnectionEvent(manager, fd, events); });
+        }
+
+        /**
+         * @brief Drains the accept queue and registers every new client.
+         *
+         *        Connections over Config::max_connections are closed right
+         *        away.
+         */
+        void AcceptConnections()
+        {
+            int client_fd;
+
+            while ((client_fd = server_.Accept()) >= 0)
+            {
+                if (active_connections_.fetch_add(1, std::memory_order_relaxed) >= max_connections_)
+                {
+                    active_connections_.fetch_sub(1, std::memory_order_relaxed);
+                    server_.Connection().Remove(client_fd);
+                    continue;
+                }
+
+                try
+                {
+                    loop_.Add(client_fd, net::EventLoop::kReadable | net::EventLoop::kWritable);
+                }
+                catch (...)
+                {
+                    CloseConnection(server_.Connection(), client_fd);
+                }
+            }
+        }
+
+        void HandleConnectionEvent(net::ConnectionManager &manager, int fd, std::uint32_t events)
+        {
+            if ((events & net::EventLoop::kError) && !(events & EPOLLIN))
+            {
+                CloseConnection(manager, fd);
+                return;
+            }
+
+            if ((events & net::EventLoop::kWritable) && !FlushConnection(manager, fd))
+            {
+                return;
+            }
+
+            if (events & net::EventLoop::kReadable)
+            {
+                ConnectionSafeProcess(manager, fd);
+            }
+        }
+
+        /**
+         * @brief Retries pending output once the socket is writable, and
+         *        resumes a paused reader once its backlog has drained.
+         *
+         * @return false if the connection was closed.
+         */
+        bool FlushConnection(net::ConnectionManager &manager, int fd)
+        {
+            try
+            {
+                auto *conn = manager.Get(fd);
+
+                if (conn->WriteToSocket() >= 0)
+                {
+                    if (conn->ReadPaused() &&
+                        conn->OutputBuffer().ReadableBytes() <= max_output_buffer_bytes_ / 2)
+                    {
+                        conn->SetReadPaused(false);
+                        loop_.Modify(fd, net::EventLoop::kReadable | net::EventLoop::kWritable);
+
+                        // Requests buffered while paused will not raise
+                        // another readiness edge; run them now.
+                        ConnectionSafeProcess(manager, fd);
+                        return manager.Find(fd) != nullptr;
+                    }
+
+                    if (conn->PeerClosed() && conn->OutputBuffer().ReadableBytes() == 0)
+                    {
+                        CloseConnection(manager, fd);
+                        return false;
+                    }
+
+                    return true;
+                }
+            }
+            catch (...)
+            {
+            }
+
+            CloseConnection(manager, fd);
+            return false;
+        }
+
+        /**
+         * @brief Reads, executes and replies to every complete request.
+         *
+         *        Execution stops while the connection has more than
+         *        Config::max_output_buffer_bytes of unsent replies; reading
+         *        is then paused (EPOLLIN dropped) until the backlog drains,
+         *        so a slow reader only delays itself.
+         */
+        void ConnectionSafeProcess(net::ConnectionManager &manager, int fd)
+        {
+            try
+            {
+                auto *conn = manager.Get(fd);
+
+                if (!conn)
+                {
+                    return;
+                }
+
+                if (!conn->ReadPaused() && conn->ReadFromSocket() < 0)
+                {
+                    CloseConnection(manager, fd);
+                    return;
+                }
+
+                bool over_limit = false;
+
+                while (!(over_limit = conn->OutputBuffer().ReadableBytes() >= max_output_buffer_bytes_) &&
+                       ExecuteNextRequest(conn))
+                {
+                }
+
+                // One gathered write for every reply produced by this batch.
+                if (conn->WriteToSocket() < 0)
+                {
+                    CloseConnection(manager, fd);
+                    return;
+                }
+
+                // Pausing re-arms EPOLLOUT, which also brings us back here if
+                // the write above already drained everything.
+                if (over_limit)
+                {
+                    if (!conn->ReadPaused())
+                    {
+                        conn->SetReadPaused(true);
+                        loop_.Modify(fd, net::EventLoop::kWritable);
+                    }
+                    return;
+                }
+
+                if (conn->PeerClosed() && conn->OutputBuffer().ReadableBytes() == 0)
+                {
+                    CloseConnection(manager, fd);
+                }
+            }
+            catch (...)
+            {
+                CloseConnection(manager, fd);
+            }
+        }
+
+        /**
+         * @brief Parses and executes the next complete request in place,
+         *        appends the reply to the connection's output buffer and
+         *        consumes the request.
+         *
+         * @return false if no complete request is buffered.
+         */
+        bool ExecuteNextRequest(net::Connection *conn)
+        {
+            protocol::WireFormat format = conn->Format();
+
+            protocol::RequestView request;
+            std::size_t frame_bytes = 0;
+            std::size_t scanned = conn->ScanOffset();
+
+            if (!protocol::WireCodec::PeekRequest(format, conn->InputBuffer(), request, frame_bytes, scanned))
+            {
+                conn->SetScanOffset(scanned);
+                return false;
+            }
+
+            // A RESP multibulk request upgrades a text connection.
+            conn->SetFormat(format);
+
+            protocol::Response response = request.CommandIs("PROTOCOL")
+                                              ? SwitchProtocol(conn, request)
+                                              : dispatcher_.Dispatch(request);
+
+            // The request's tokens point into the frame; release it only now.
+            conn->InputBuffer().Consume(frame_bytes);
+            conn->SetScanOffset(0);
+
+            protocol::WireCodec::AppendReply(format, std::move(response), conn->OutputBuffer());
+
+            return true;
+        }
+
+        /**
+         * @brief Handles "PROTOCOL TEXT|BINARY". The reply is still sent in
+         *        the old format; later requests use the new one.
+         */
+        static protocol::Response SwitchProtocol(net::Connection *conn, const protocol::RequestView &request)
+        {
+            if (request.ArgCount() == 1 && request.Arg(0) == "BINARY")
+            {
+                conn->SetFormat(protocol::WireFormat::kBinary);
+                return protocol::Response::Ok();
+            }
+
+            if (request.ArgCount() == 1 && request.Arg(0) == "TEXT")
+            {
+                conn->SetFormat(protocol::WireFormat::kText);
+                return protocol::Response::Ok();
+            }
+
+            return protocol::Response::Error("PROTOCOL requires TEXT or BINARY");
+        }
+
+        void CloseConnection(net::ConnectionManager &manager, int fd)
+        {
+            const std::size_t before = manager.Size();
+
+            loop_.Remove(fd);
+            manager.Remove(fd);
+
+            if (manager.Size() < before)
+            {
+                active_connections_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+
+#if defined(KVMEMO_WITH_IO_URING)
+        // ------------------------------------------------------------
+        // io_uring backend
+        // ------------------------------------------------------------
+
+        static constexpr unsigned kRingEntries = 4096;
+        static constexpr std::uint16_t kBufferGroup = 0;
+        static constexpr unsigned kRecvBufferCount = 1024;
+        static constexpr std::size_t kRecvBufferSize = 4096;
+
+        enum class UringOp : std::uint8_t
+        {
+            kAccept = 1,
+            kRecv = 2,
+            kSend = 3,
+            kWakeup = 4,
+        };
+
+        static std::uint64_t Tag(UringOp op, int fd) noexcept
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(fd)) << 8) |
+                   static_cast<std::uint64_t>(op);
+        }
+
+        /**
+         * @brief Sets up the ring, or returns nullptr to fall back to epoll.
+         */
+        std::unique_ptr<net::IoUring> CreateRing()
+        {
+            if (!net::IoUring::KernelSupportsMultishotRecv())
+            {
+                KV_LOG_WARN("Kernel lacks io_uring multishot recv; using epoll");
+                return nullptr;
+            }
+
+            try
+            {
+                auto ring = std::make_unique<net::IoUring>(kRingEntries);
+                ring->RegisterBuffers(kBufferGroup, kRecvBufferCount, kRecvBufferSize);
+                return ring;
+            }
+            catch (const std::exception &ex)
+            {
+                KV_LOG_WARN(std::string("io_uring unavailable (") + ex.what() + "); using epoll");
+                return nullptr;
+            }
+        }
+
+        void RunIoUring(net::IoUring &ring)
+        {
+            ArmAccept(ring);
+            ArmWakeup(ring);
+
+            while (!stop_.load(std::memory_order_acquire))
+            {
+                ring.Submit(1);
+                ring.DrainCompletions([&](const io_uring_cqe &cqe)
+                                      { HandleCompletion(ring, cqe); });
+            }
+        }
+
+        io_uring_sqe *NextSqe(net::IoUring &ring)
+        {
+            io_uring_sqe *sqe = ring.GetSqe();
+            if (sqe == nullptr)
+            {
+                ring.Submit(0);
+                sqe = ring.GetSqe();
+            }
+            if (sqe == nullptr)
+            {
+                throw std::runtime_error("io_uring submission queue full");
+            }
+            return sqe;
+        }
+
+        void ArmAccept(net::IoUring &ring)
+        {
+            io_uring_sqe *sqe = NextSqe(ring);
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->fd = server_.ListenFD();
+            sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+            sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+            sqe->user_data = Tag(UringOp::kAccept, server_.ListenFD());
+        }
+
+        void ArmWakeup(net::IoUring &ring)
+        {
+            io_uring_sqe *sqe = NextSqe(ring);
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->fd = loop_.WakeupFD();
+            sqe->poll32_events = POLLIN;
+            sqe->len = IORING_POLL_ADD_MULTI;
+            sqe->user_data = Tag(UringOp::kWakeup, loop_.WakeupFD());
+        }
+
+        void ArmRecv(net::IoUring &ring, net::Connection *conn)
+        {
+            io_uring_sqe *sqe = NextSqe(ring);
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = conn->FD();
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = kBufferGroup;
+            sqe->user_data = Tag(UringOp::kRecv, conn->FD());
+            conn->Uring().recv_armed = true;
+        }
+
+        /**
+         * @brief Starts a send of everything pending, unless one is already
+         *        in flight.
+         */
+        void QueueSend(net::IoUring &ring, net::Connection *conn)
+        {
+            auto &state = conn->Uring();
+
+            if (state.send_inflight)
+            {
+                return;
+            }
+
+            if (state.inflight.ReadableBytes() == 0)
+            {
+                if (conn->OutputBuffer().ReadableBytes() == 0)
+                {
+                    return;
+                }
+                std::swap(state.inflight, conn->OutputBuffer());
+            }
+
+            state.msg = msghdr{};
+            state.msg.msg_iov = state.iov.data();
+            state.msg.msg_iovlen = static_cast<std::size_t>(
+                state.inflight.Gather(state.iov.data(), static_cast<int>(state.iov.size())));
+
+            io_uring_sqe *sqe = NextSqe(ring);
+            sqe->opcode = IORING_OP_SENDMSG;
+            sqe->fd = conn->FD();
+            sqe->addr = reinterpret_cast<std::uint64_t>(&state.msg);
+            sqe->len = 1;
+            sqe->msg_flags = MSG_NOSIGNAL;
+            sqe->user_data = Tag(UringOp::kSend, conn->FD());
+            state.send_inflight = true;
+        }
+
+        void HandleCompletion(net::IoUring &ring, const io_uring_cqe &cqe)
+        {
+            const auto op = static_cast<UringOp>(cqe.user_data & 0xff);
+            const int fd = static_cast<int>(cqe.user_data >> 8);
+            const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+
+            switch (op)
+            {
+            case UringOp::kAccept:
+                if (cqe.res >= 0)
+                {
+                    AdoptConnection(ring, cqe.res);
+                }
+                if (!more && !stop_.load(std::memory_order_acquire))
+                {
+                    ArmAccept(ring);
+                }
+                return;
+
+            case UringOp::kWakeup:
+                loop_.DrainWakeup();
+                if (!more)
+                {
+                    ArmWakeup(ring);
+                }
+                return;
+
+            case UringOp::kRecv:
+                HandleRecv(ring, fd, cqe, more);
+                return;
+
+            case UringOp::kSend:
+                HandleSend(ring, fd, cqe.res);
+                return;
+            }
+        }
+
+        void AdoptConnection(net::IoUring &ring, int client_fd)
+        {
+            if (active_connections_.fetch_add(1, std::memory_order_relaxed) >= max_connections_)
+            {
+                active_connections_.fetch_sub(1, std::memory_order_relaxed);
+                ::close(client_fd);
+                return;
+            }
+
+            auto conn = std::make_unique<net::Connection>(client_fd);
+            net::Connection *raw = conn.get();
+            server_.Connection().Add(std::move(conn));
+
+            ArmRecv(ring, raw);
+        }
+
+        void HandleRecv(net::IoUring &ring, int fd, const io_uring_cqe &cqe, bool more)
+        {
+            auto &manager = server_.Connection();
+            net::Connection *conn = manager.Find(fd);
+
+            if (cqe.flags & IORING_CQE_F_BUFFER)
+            {
+                const auto bid = static_cast<std::uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+                if (conn != nullptr && cqe.res > 0)
+                {
+                    conn->InputBuffer().Append(ring.BufferData(bid), static_cast<std::size_t>(cqe.res));
+                }
+                ring.RecycleBuffer(bid);
+            }
+
+            if (conn == nullptr)
+            {
+                return;
+            }
+
+            auto &state = conn->Uring();
+
+            if (!more)
+            {
+                state.recv_armed = false;
+
+                // ENOBUFS (provided buffers ran out) and a cancel issued by
+                // PauseRecv() leave the socket healthy.
+                const bool healthy = cqe.res > 0 ||
+                                     cqe.res == -ENOBUFS ||
+                                     (cqe.res == -ECANCELED && conn->ReadPaused());
+                if (!healthy)
+                {
+                    state.closing = true;
+                }
+            }
+
+            if (cqe.res > 0 && !state.closing)
+            {
+                ProcessFrames(ring, conn);
+            }
+
+            if (!state.recv_armed && !state.closing && !conn->ReadPaused())
+            {
+                ArmRecv(ring, conn);
+            }
+
+            MaybeFinishClose(ring, conn);
+        }
+
+        static std::size_t PendingOutput(net::Connection *conn) noexcept
+        {
+            return conn->OutputBuffer().ReadableBytes() + conn->Uring().inflight.ReadableBytes();
+        }
+
+        /**
+         * @brief Executes buffered requests up to the output limit and
+         *        queues the replies; pauses receiving once over the limit.
+         */
+        void ProcessFrames(net::IoUring &ring, net::Connection *conn)
+        {
+            auto &state = conn->Uring();
+
+            try
+            {
+                while (PendingOutput(conn) < max_output_buffer_bytes_ &&
+                       ExecuteNextRequest(conn))
+                {
+                }
+            }
+            catch (...)
+            {
+                state.closing = true;
+            }
+
+            QueueSend(ring, conn);
+
+            if (!state.closing && !conn->ReadPaused() &&
+                PendingOutput(conn) >= max_output_buffer_bytes_)
+            {
+                conn->SetReadPaused(true);
+
+                if (state.recv_armed)
+                {
+                    PauseRecv(ring, conn);
+                }
+            }
+        }
+
+        /**
+         * @brief Cancels the multishot recv; HandleRecv() sees -ECANCELED.
+         */
+        void PauseRecv(net::IoUring &ring, net::Connection *conn)
+        {
+            io_uring_sqe *sqe = NextSqe(ring);
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->addr = Tag(UringOp::kRecv, conn->FD());
+            sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+            sqe->user_data = net::IoUring::kInternalUserData;
+        }
+
+        void HandleSend(net::IoUring &ring, int fd, int res)
+        {
+            net::Connection *conn = server_.Connection().Find(fd);
+
+            if (conn == nullptr)
+            {
+                return;
+            }
+
+            auto &state = conn->Uring();
+            state.send_inflight = false;
+
+            if (res < 0)
+            {
+                state.closing = true;
+                state.inflight.Clear();
+                conn->OutputBuffer().Clear();
+            }
+            else
+            {
+                state.inflight.Consume(static_cast<std::size_t>(res));
+                QueueSend(ring, conn);
+
+                if (conn->ReadPaused() && !state.closing &&
+                    PendingOutput(conn) <= max_output_buffer_bytes_ / 2)
+                {
+                    conn->SetReadPaused(false);
+                    ProcessFrames(ring, conn);
+
+                    if (!conn->ReadPaused() && !state.recv_armed && !state.closing)
+                    {
+                        ArmRecv(ring, conn);
+                    }
+                }
+            }
+
+            MaybeFinishClose(ring, conn);
+        }
+
+        /**
+         * @brief Completes a close once no operation references the socket.
+         *
+         *        Pending replies are still flushed; the receive side is shut
+         *        down so the multishot recv terminates.
+         */
+        void MaybeFinishClose(net::IoUring &ring, net::Connection *conn)
+        {
+            auto &state = conn->Uring();
+
+            if (!state.closing)
+            {
+                return;
+            }
+
+            if (state.recv_armed)
+            {
+                if (!state.shut_down)
+                {
+                    ::shutdown(conn->FD(), SHUT_RD);
+                    state.shut_down = true;
+                }
+                return;
+            }
+
+            QueueSend(ring, conn);
+
+            if (!state.send_inflight)
+            {
+                CloseConnection(server_.Connection(), conn->FD());
+            }
+        }
+#endif // KVMEMO_WITH_IO_URING
+
+    private:
+        net::TcpServer server_;
+        net::EventLoop loop_;
+        Dispatcher &dispatcher_;
+
+        std::atomic<std::size_t> &active_connections_;
+        const std::size_t max_connections_;
+        const std::size_t max_output_buffer_bytes_;
+        const common::IoBackend io_backend_;
+        std::atomic<bool> stop_{false};
+    };
+} // namespace kvmemo::server
+
+/**
+ * This source code may not be copied, modified, or
+ * distributed without explicit permission from the author.
+ */
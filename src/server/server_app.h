@@ -1,21 +1,54 @@
 #pragma once
 /**
+ * @file server_app.h
+ * @brief Top-level server application.
+ *
+ * Responsibilities :
+ * - Build the KVEngine and Dispatcher from Config.
+ * - Run one Reactor (event loop) per worker thread.
+ *
+ * Threading :
+ * > Config::worker_threads reactors run in parallel, each with its own
+ *   SO_REUSEPORT listening socket and its own ConnectionManager.
+ * > worker_threads == 0 means one reactor per hardware thread.
+ * > With Config::lock_free_reads every reactor holds an epoch slot, so
+ *   there are at most core::EpochDomain::kMaxThreads of them: more are
+ *   rejected at construction, and auto-detection is capped.
+ * > The calling thread drives the first reactor; Run() returns after
+ *   Stop() once every reactor has exited.
+ * > A CoarseClock ticker thread runs for the application's lifetime.
+ * > While Run() is active a TTLManager thread expires due keys every
+ *   Config::ttl_sweep_interval_ms (when Config::enable_ttl is set).
+ * > While Run() is active an Evictor thread keeps memory between the
+ *   eviction watermarks (unless Config::eviction_policy is kNone, in
+ *   which case writes are refused at max_memory_bytes).
+ *
  *  Copyright © 2026 KVMemo
  *  Author: Gagan Bansal
  *  ALL RIGHTS RESERVED.
  */
-#include <string>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
-#include <sys/select.h>
 
-#include "../net/tcp_server.h"
-#include "../protocol/framing.h"
-#include "../protocol/parser.h"
-#include "../protocol/serializer.h"
-#include "../protocol/response.h"
+#include "../common/config.h"
+#include "../common/logger.h"
+#include "../common/time.h"
+#include "../core/epoch.h"
 #include "../core/kv_engine.h"
+#include "../eviction/evictor.h"
+#include "../eviction/sampled_lru_policy.h"
+#include "../eviction/tiny_lfu_policy.h"
+#include "../eviction/ttl_manager.h"
 #include "dispatcher.h"
+#include "reactor.h"
 
 namespace kvmemo::server
 {
@@ -26,134 +59,258 @@ namespace kvmemo::server
     class ServerApp final
     {
     public:
-        explicit ServerApp(int port) : server_(port), engine_(std::make_unique<core::ShardManager>(64, 10000),
-                                                              std::make_unique<core::TTLIndex>(),
-                                                              std::make_unique<eviction::EvictionManager>(
-                                                                  std::make_unique<eviction::MemoryTracker>(256 * 1024 * 1024),
-                                                                  std::make_unique<eviction::LRUPolicy>(
-                                                                      std::make_unique<core::LRUCache>(10000)))),
-                                       dispatcher_(engine_) {}
+        explicit ServerApp(const common::Config &config)
+            : config_(ValidatedConfig(config)),
+              engine_(std::make_unique<core::ShardManager>(
+                          config_.shard_count,
+                          kShardCapacity,
+                          config_.lock_free_reads ? core::ReadMode::kLockFree : core::ReadMode::kShared,
+                          Tracking(config_)),
+                      std::make_unique<eviction::EvictionManager>(
+                          std::make_unique<eviction::MemoryTracker>(
+                              config_.max_memory_bytes,
+                              config_.eviction_high_watermark_percent,
+                              config_.eviction_low_watermark_percent,
+                              config_.shard_count),
+                          PolicyFactory(config_),
+                          config_.shard_count)),
+              dispatcher_(engine_)
+        {
+            if (config_.enable_ttl)
+            {
+                ttl_manager_ = std::make_unique<eviction::TTLManager>(
+                    engine_, std::chrono::milliseconds(config_.ttl_sweep_interval_ms));
+            }
+
+            if (config_.eviction_policy != common::EvictionPolicy::kNone)
+            {
+                evictor_ = std::make_unique<eviction::Evictor>(
+                    engine_, std::chrono::milliseconds(config_.eviction_interval_ms));
+            }
+        }
+
+        explicit ServerApp(int port) : ServerApp(ConfigForPort(port)) {}
 
         ServerApp(const ServerApp &) = delete;
         ServerApp &operator=(const ServerApp &) = delete;
 
-        ServerApp(ServerApp &&) noexcept = default;
-        ServerApp &operator=(ServerApp &&) noexcept = delete;
+        ServerApp(ServerApp &&) = delete;
+        ServerApp &operator=(ServerApp &&) = delete;
 
-        ~ServerApp() = default;
+        ~ServerApp()
+        {
+            Stop();
+            JoinWorkers();
+        }
 
         /**
-         * @brief Starts the server runtime loop.
+         * @brief Starts all event loops and blocks until Stop(). Returns
+         *        at once if Stop() was already called.
          */
         void Run()
         {
-            server_.Start();
-
-            while (true)
+            if (stopping_.load(std::memory_order_acquire))
             {
-                ProcessConnections();
+                return;
             }
-        }
 
-    private:
-        /**
-         * @brief Accepts new connections and processes requests for all active
-         *        connections using select() for event-driven I/O.
-         *
-         *        The listening socket is included in the select() watch set so
-         *        that the loop never blocks waiting for a new connection while
-         *        existing clients are waiting for their commands to be handled.
-         */
-        void ProcessConnections()
-        {
-            auto &manager = server_.Connection();
-            fd_set readfds;
-            FD_ZERO(&readfds);
-
-            int listen_fd = server_.ListenFD();
-            FD_SET(listen_fd, &readfds);
-            int max_fd = listen_fd;
-
-            active_fds_.clear();
-            manager.ForEachConnection([&](int fd, net::Connection *conn)
-                                      {
-                FD_SET(fd, &readfds);
-                max_fd = std::max(max_fd, fd);
-                active_fds_.push_back(fd); });
+            const std::size_t loops = EventLoopCount();
+            const bool reuse_port = loops > 1;
 
-            struct timeval tv = {0, kSelectTimeoutUs};
-            int activity = select(max_fd + 1, &readfds, nullptr, nullptr, &tv);
+            if (ttl_manager_)
+            {
+                ttl_manager_->Start();
+            }
 
-            if (activity < 0)
-                return;
+            if (evictor_)
+            {
+                evictor_->Start();
+            }
 
-            if (activity > 0)
+            for (std::size_t i = 0; i < loops; ++i)
             {
-                if (FD_ISSET(listen_fd, &readfds))
+                auto reactor = std::make_unique<Reactor>(config_,
+                                                         reuse_port,
+                                                         dispatcher_,
+                                                         active_connections_);
+                reactor->Start();
+
+                // Stop() sets stopping_ before it takes the lock, so either
+                // it sees this reactor or this check sees stopping_.
+                std::lock_guard<std::mutex> lock(reactors_mutex_);
+                reactors_.push_back(std::move(reactor));
+                if (stopping_.load(std::memory_order_acquire))
                 {
-                    server_.Accept();
+                    reactors_.back()->Stop();
+                    break;
                 }
+            }
 
-                for (int fd : active_fds_)
-                {
-                    if (FD_ISSET(fd, &readfds))
+            for (std::size_t i = 1; i < reactors_.size(); ++i)
+            {
+                Reactor *reactor = reactors_[i].get();
+                workers_.emplace_back([reactor]
+                                      {
+                    try
                     {
-                        ConnectionSafeProcess(manager, fd);
+                        reactor->Run();
                     }
-                }
+                    catch (const std::exception &ex)
+                    {
+                        KV_LOG_ERROR(std::string("Event loop terminated: ") + ex.what());
+                    } });
+            }
+
+            reactors_.front()->Run();
+
+            JoinWorkers();
+
+            if (ttl_manager_)
+            {
+                ttl_manager_->Stop();
+            }
+
+            if (evictor_)
+            {
+                evictor_->Stop();
             }
         }
 
-        void ConnectionSafeProcess(net::ConnectionManager &manager, int fd)
+        /**
+         * @brief Stops every event loop, including those Run() has yet to
+         *        start. Safe to call from any thread, before or during Run().
+         */
+        void Stop() noexcept
         {
-            try
+            stopping_.store(true, std::memory_order_release);
+
+            std::lock_guard<std::mutex> lock(reactors_mutex_);
+            for (auto &reactor : reactors_)
             {
-                auto *conn = manager.Get(fd);
+                reactor->Stop();
+            }
+        }
 
-                if (!conn)
-                {
-                    return;
-                }
+        /**
+         * @brief Number of event-loop threads Run() starts.
+         */
+        std::size_t EventLoopCount() const noexcept
+        {
+            if (config_.worker_threads > 0)
+            {
+                return config_.worker_threads;
+            }
 
-                if (conn->ReadFromSocket() <= 0)
-                {
-                    manager.Remove(fd);
-                    return;
-                }
+            const unsigned int hw = std::thread::hardware_concurrency();
+            const std::size_t loops = hw == 0 ? 1 : hw;
+            return config_.lock_free_reads ? std::min(loops, core::EpochDomain::kMaxThreads) : loops;
+        }
 
-                std::string frame;
+    private:
+        // Memory, not key count, bounds the store.
+        static constexpr std::size_t kShardCapacity = std::numeric_limits<std::size_t>::max();
 
-                while (protocol::Framing::NextFrame(conn->InputBuffer(), frame))
-                {
-                    auto request = protocol::Parser::Parse(frame);
+        // Only LRUPolicy reads the shards' recency lists; other policies
+        // keep their own order or sample access clocks, so hits need only
+        // stamp the record.
+        static core::AccessTracking Tracking(const common::Config &config)
+        {
+            switch (config.eviction_policy)
+            {
+            case common::EvictionPolicy::kSampledLRU:
+            case common::EvictionPolicy::kTinyLFU:
+            case common::EvictionPolicy::kLFU:
+                return core::AccessTracking::kSampled;
+            default:
+                return core::AccessTracking::kOrdered;
+            }
+        }
 
-                    protocol::Response response = dispatcher_.Dispatch(request);
+        static eviction::EvictionManager::PolicyFactory PolicyFactory(const common::Config &config)
+        {
+            switch (config.eviction_policy)
+            {
+            case common::EvictionPolicy::kNone:
+                return []
+                { return std::make_unique<eviction::NoEvictionPolicy>(); };
+            case common::EvictionPolicy::kSampledLRU:
+                return [samples = config.eviction_samples]
+                { return std::make_unique<eviction::SampledLRUPolicy>(samples); };
+            case common::EvictionPolicy::kTinyLFU:
+                return []
+                { return std::make_unique<eviction::TinyLFUPolicy>(); };
+            case common::EvictionPolicy::kLFU:
+                return [log_factor = config.lfu_log_factor, decay_ms = config.lfu_decay_ms]
+                { return std::make_unique<eviction::LFUPolicy>(log_factor, decay_ms); };
+            default:
+                return []
+                { return std::make_unique<eviction::LRUPolicy>(); };
+            }
+        }
 
-                    std::string wire = protocol::Serializer::Serialize(response);
+        static common::Config ConfigForPort(int port)
+        {
+            common::Config config;
+            config.listen_port = static_cast<std::uint16_t>(port);
+            return config;
+        }
 
-                    conn->OutputBuffer().Append(wire);
+        static const common::Config &ValidatedConfig(const common::Config &config)
+        {
+            common::Status status = config.Validate();
+            if (!status.ok())
+            {
+                throw std::invalid_argument(status.ToString());
+            }
 
-                    conn->WriteToSocket();
-                }
+            // Each reactor claims an epoch slot on its first lock-free GET.
+            if (config.lock_free_reads && config.worker_threads > core::EpochDomain::kMaxThreads)
+            {
+                throw std::invalid_argument("Config.worker_threads must be <= " +
+                                            std::to_string(core::EpochDomain::kMaxThreads) +
+                                            " with lock_free_reads");
             }
-            catch (...)
+            return config;
+        }
+
+        void JoinWorkers()
+        {
+            for (auto &worker : workers_)
             {
-                manager.Remove(fd);
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
             }
+            workers_.clear();
         }
 
     private:
-        static constexpr int kSelectTimeoutUs = 50000;
+        const common::Config config_;
+
+        // Refreshes common::CoarseClock, which every TTL check reads.
+        common::CoarseClock::Ticker clock_ticker_;
 
-        Dispatcher dispatcher_;
-        net::TcpServer server_;
         core::KVEngine engine_;
+        Dispatcher dispatcher_;
+
+        // Active expiry; null when Config::enable_ttl is false.
+        std::unique_ptr<eviction::TTLManager> ttl_manager_;
 
-        std::vector<int> active_fds_;
+        // Background eviction; null when Config::eviction_policy is kNone.
+        std::unique_ptr<eviction::Evictor> evictor_;
+
+        std::atomic<std::size_t> active_connections_{0};
+        // Appended to only by Run(), under reactors_mutex_; Stop() walks it
+        // under the same lock.
+        std::mutex reactors_mutex_;
+        std::vector<std::unique_ptr<Reactor>> reactors_;
+        std::atomic<bool> stopping_{false};
+        std::vector<std::thread> workers_;
     };
 } // namespace kvmemo::server
 
 /**
  * This source code may not be copied, modified, or
  * distributed without explicit permission from the author.
- */
\ No newline at end of file
+ */
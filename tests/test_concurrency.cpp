@@ -534,6 +534,194 @@ class TestHighContention : public ConcurrencyTestBase {
   void Run() { ExecuteTest(); }
 };
 
+// ============================================================================
+// Test 7: Shared-Lock Readers With Evicting Writers
+// ============================================================================
+
+/**
+ * @brief Test: GET hits buffered under the shared lock stay valid while
+ *        other threads overwrite, delete and evict the same records.
+ *
+ * Validates:
+ *  - Readers see only values that were written for the key
+ *  - Buffered accesses are replayed before records are freed
+ *  - The shard stays within capacity
+ */
+class TestSharedReadersWithEviction : public ConcurrencyTestBase {
+ private:
+  core::Shard shard_{32};
+
+  void RunTest(std::size_t thread_id, TestMetrics& metrics) override {
+    const std::size_t ops = 2000;
+
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::string key = "hot_" + std::to_string(i % 48);
+
+      if (thread_id == 0) {
+        if (i % 7 == 0) {
+          shard_.Delete(key);
+        } else {
+          // Alternate sizes so some overwrites replace the record.
+          shard_.Set(key, key + std::string(i % 2 == 0 ? 4 : 200, '#'));
+        }
+        metrics.RecordWrite();
+        continue;
+      }
+
+      auto value = shard_.Get(key);
+      if (!value.has_value()) {
+        continue;
+      }
+
+      if (value->compare(0, key.size(), key) == 0) {
+        metrics.RecordRead();
+      } else {
+        metrics.RecordError();
+        AssertTrue(false, "Reader saw a value written for another key");
+      }
+    }
+  }
+
+ public:
+  explicit TestSharedReadersWithEviction(std::size_t num_threads = 8)
+      : ConcurrencyTestBase("Shared-Lock Readers With Eviction", num_threads) {}
+
+  void Run() {
+    ExecuteTest();
+
+    AssertTrue(shard_.Size() <= 32,
+               "Shard size should not exceed capacity: size=" +
+                   std::to_string(shard_.Size()));
+  }
+};
+
+// ============================================================================
+// Test 8: Lock-Free Readers With Writers
+// ============================================================================
+
+/**
+ * @brief Test: Lock-free GETs never see a freed or foreign record while
+ *        writers replace, delete, evict and clear underneath them.
+ *
+ * Validates:
+ *  - Readers see only values that were written for the key
+ *  - Retired records and index tables outlive concurrent readers
+ *  - The shard stays within capacity
+ */
+class TestLockFreeReadersWithWriters : public ConcurrencyTestBase {
+ private:
+  core::Shard shard_{32, core::ReadMode::kLockFree};
+
+  void RunTest(std::size_t thread_id, TestMetrics& metrics) override {
+    const std::size_t ops = 4000;
+
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::string key = "hot_" + std::to_string(i % 48);
+
+      if (thread_id == 0) {
+        if (i % 997 == 0) {
+          shard_.Clear();
+        } else if (i % 7 == 0) {
+          shard_.Delete(key);
+        } else {
+          shard_.Set(key, key + std::string(i % 2 == 0 ? 4 : 200, '#'));
+        }
+        metrics.RecordWrite();
+        continue;
+      }
+
+      auto value = shard_.Get(key);
+      if (!value.has_value()) {
+        continue;
+      }
+
+      if (value->compare(0, key.size(), key) == 0) {
+        metrics.RecordRead();
+      } else {
+        metrics.RecordError();
+        AssertTrue(false, "Reader saw a value written for another key");
+      }
+    }
+  }
+
+ public:
+  explicit TestLockFreeReadersWithWriters(std::size_t num_threads = 8)
+      : ConcurrencyTestBase("Lock-Free Readers With Writers", num_threads) {}
+
+  void Run() {
+    ExecuteTest();
+
+    AssertTrue(shard_.Size() <= 32,
+               "Shard size should not exceed capacity: size=" +
+                   std::to_string(shard_.Size()));
+  }
+};
+
+// ============================================================================
+// Test 9: Policy Sees Writes And Deletes In Store Order
+// ============================================================================
+
+/**
+ * @brief Test: SETs and DELs racing on the same keys leave the eviction
+ *        policy tracking exactly the keys the store holds.
+ *
+ * Validates:
+ *  - A key that survives the race is still known to the policy, so it can
+ *    be evicted
+ *  - The policy keeps no node for a key the store no longer holds
+ */
+class TestPolicyWriteDeleteOrder : public ConcurrencyTestBase {
+ private:
+  eviction::LFUPolicy* policy_ = nullptr;
+  core::KVEngine engine_{
+      std::make_unique<core::ShardManager>(1, 1 << 20, core::ReadMode::kShared,
+                                           core::AccessTracking::kSampled),
+      std::make_unique<eviction::EvictionManager>(
+          std::make_unique<eviction::MemoryTracker>(1ULL << 30),
+          [this] {
+            auto policy = std::make_unique<eviction::LFUPolicy>();
+            policy_ = policy.get();
+            return policy;
+          })};
+
+  // Setters and deleters walk the same keys once, in the same order, so
+  // whichever thread is preempted between a store change and its policy
+  // hook leaves that key's final state to the race.
+  void RunTest(std::size_t thread_id, TestMetrics& metrics) override {
+    const std::size_t ops = 100000;
+
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::string key = "race_" + std::to_string(i);
+
+      if (thread_id % 2 == 0) {
+        engine_.Set(key, "v");
+        metrics.RecordWrite();
+      } else {
+        engine_.Delete(key);
+        metrics.RecordDelete();
+      }
+    }
+  }
+
+ public:
+  explicit TestPolicyWriteDeleteOrder(std::size_t num_threads = 2)
+      : ConcurrencyTestBase("Policy Write/Delete Order", num_threads) {}
+
+  void Run() {
+    ExecuteTest();
+
+    const auto stored = engine_.GetAllKeys();
+    AssertTrue(policy_->Size() == stored.size(),
+               "Policy should track exactly the stored keys: policy=" +
+                   std::to_string(policy_->Size()) +
+                   " store=" + std::to_string(stored.size()));
+    for (const auto& [key, value] : stored) {
+      AssertTrue(policy_->Count(key).has_value(),
+                 "Stored key unknown to the policy: " + key);
+    }
+  }
+};
+
 // ============================================================================
 // Test Runner
 // ============================================================================
@@ -593,12 +781,33 @@ class TestSuite final {
       passed_ += test.TestPassed() ? 1 : 0;
     }
 
+    // Test 7
+    {
+      TestSharedReadersWithEviction test(8);
+      test.Run();
+      passed_ += test.TestPassed() ? 1 : 0;
+    }
+
+    // Test 8
+    {
+      TestLockFreeReadersWithWriters test(8);
+      test.Run();
+      passed_ += test.TestPassed() ? 1 : 0;
+    }
+
+    // Test 9
+    {
+      TestPolicyWriteDeleteOrder test(2);
+      test.Run();
+      passed_ += test.TestPassed() ? 1 : 0;
+    }
+
     PrintSummary();
   }
 
  private:
   void PrintSummary() {
-    const int total_tests = 6;
+    const int total_tests = 9;
     std::cout << "\n" << std::string(70, '=') << "\n";
     std::cout << "Test Summary\n";
     std::cout << std::string(70, '=') << "\n";
@@ -20,10 +20,22 @@
 #include <optional>
 #include <chrono>
 #include <thread>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
 
+#include "src/core/flat_hash_map.h"
 #include "src/core/lru_cache.h"
+#include "src/core/shard.h"
+#include "src/core/ttl_index.h"
+#include "src/core/kv_engine.h"
+#include "src/eviction/evictor.h"
+#include "src/eviction/sampled_lru_policy.h"
+#include "src/eviction/tiny_lfu_policy.h"
+#include "src/eviction/ttl_manager.h"
 #include "src/common/status.h"
 #include "src/common/config.h"
+#include "src/common/time.h"
 
 namespace kvmemo::tests {
 
@@ -384,6 +396,1288 @@ TestResult TestLRUCacheEmptyAccess() {
 
 } // namespace lru_cache_tests
 
+// ============================================================================
+// Test Suite: FlatHashMap
+// ============================================================================
+
+namespace flat_hash_map_tests {
+
+/**
+ * @brief Test: FlatHashMap insert, overwrite, lookup and erase.
+ *
+ * Validates:
+ *  - operator[] inserts and overwrites
+ *  - try_emplace does not overwrite an existing key
+ *  - erase removes exactly one key
+ */
+TestResult TestFlatHashMapBasicOperations() {
+    try {
+        core::FlatHashMap<std::string, std::string> map;
+
+        map["alpha"] = "1";
+        map["beta"] = "2";
+        map["alpha"] = "3";
+        bool inserted = map.try_emplace("beta", "ignored").second;
+
+        bool correct = map.size() == 2 && !inserted &&
+                       map.find("alpha")->second == "3" &&
+                       map.find("beta")->second == "2" &&
+                       map.find("gamma") == map.end() &&
+                       map.erase("alpha") == 1 && map.erase("alpha") == 0 &&
+                       map.size() == 1 && map.count("beta") == 1;
+
+        return TestResult(
+            "FlatHashMap::BasicOperations",
+            correct,
+            correct ? "" : "Map operations returned unexpected results"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("FlatHashMap::BasicOperations", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: FlatHashMap matches std::unordered_map under random churn.
+ *
+ * Validates:
+ *  - Growth, tombstones and in-place rehashes keep every key reachable
+ *  - Iteration visits each live element exactly once
+ */
+TestResult TestFlatHashMapMatchesUnorderedMap() {
+    try {
+        core::FlatHashMap<std::string, int> map;
+        std::unordered_map<std::string, int> reference;
+        std::mt19937 rng(42);
+
+        for (int i = 0; i < 200000; ++i) {
+            std::string key = "key" + std::to_string(rng() % 5000);
+
+            if (rng() % 3 == 0) {
+                if (map.erase(key) != reference.erase(key)) {
+                    return TestResult("FlatHashMap::MatchesUnorderedMap", false, "Erase mismatch for " + key);
+                }
+            } else {
+                map[key] = i;
+                reference[key] = i;
+            }
+        }
+
+        size_t visited = 0;
+        for (const auto& [key, value] : map) {
+            auto it = reference.find(key);
+            if (it == reference.end() || it->second != value) {
+                return TestResult("FlatHashMap::MatchesUnorderedMap", false, "Unexpected element " + key);
+            }
+            ++visited;
+        }
+
+        bool correct = visited == reference.size() && map.size() == reference.size();
+        return TestResult(
+            "FlatHashMap::MatchesUnorderedMap",
+            correct,
+            correct ? "" : "Size mismatch after churn"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("FlatHashMap::MatchesUnorderedMap", false, ex.what());
+    }
+}
+
+/**
+ * @brief Hasher mapping every key to the same bucket.
+ */
+struct ConstantHash {
+    size_t operator()(int) const noexcept { return 7; }
+};
+
+/**
+ * @brief Test: FlatHashMap with all keys colliding.
+ *
+ * Validates:
+ *  - Probing continues across groups until the key or an empty slot
+ *  - Keys past an erased one stay reachable
+ */
+TestResult TestFlatHashMapFullCollisions() {
+    try {
+        core::FlatHashMap<int, int, ConstantHash> map;
+
+        for (int i = 0; i < 100; ++i) {
+            map[i] = i * 2;
+        }
+        for (int i = 0; i < 100; i += 2) {
+            map.erase(i);
+        }
+
+        bool correct = map.size() == 50;
+        for (int i = 0; i < 100 && correct; ++i) {
+            auto it = map.find(i);
+            correct = (i % 2 == 0) ? it == map.end() : (it != map.end() && it->second == i * 2);
+        }
+
+        return TestResult(
+            "FlatHashMap::FullCollisions",
+            correct,
+            correct ? "" : "Colliding key lookup failed"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("FlatHashMap::FullCollisions", false, ex.what());
+    }
+}
+
+} // namespace flat_hash_map_tests
+
+// ============================================================================
+// Test Suite: Shard
+// ============================================================================
+
+namespace shard_tests {
+
+/**
+ * @brief Test: Shard evicts its least recently used key.
+ *
+ * Validates:
+ *  - A GET hit refreshes recency
+ *  - Inserting past capacity evicts the LRU key only
+ *  - Overwrites and deletes keep size and recency consistent
+ */
+TestResult TestShardLRUEviction() {
+    try {
+        core::Shard shard(3);
+
+        shard.Set("a", "1");
+        shard.Set("b", "2");
+        shard.Set("c", "3");
+        shard.Get("a");          // order (MRU -> LRU): a c b
+        shard.Set("d", "4");     // evicts b
+        shard.Set("c", "33");    // order: c d a
+        shard.Delete("d");       // order: c a
+        shard.Set("e", "5");
+        shard.Set("f", "6");     // evicts a
+
+        bool correct = shard.Size() == 3 &&
+                       !shard.Get("a").has_value() && !shard.Get("b").has_value() &&
+                       shard.Get("c") == std::optional<std::string>("33") &&
+                       shard.Get("e").has_value() && shard.Get("f").has_value();
+
+        return TestResult(
+            "Shard::LRUEviction",
+            correct,
+            correct ? "" : "Unexpected keys after eviction"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::LRUEviction", false, ex.what());
+    }
+}
+
+
+/**
+ * @brief Test: Overwrites keep the record, LRU and TTL state consistent.
+ *
+ * Validates:
+ *  - Growing and shrinking a value (record reallocated) keeps the key
+ *  - Removing the TTL on overwrite unschedules the record
+ *  - CleanupExpired removes exactly the keys still carrying a TTL
+ */
+TestResult TestShardOverwriteRecord() {
+    try {
+        core::Shard shard(8);
+        const std::string big(1000, 'x');
+
+        shard.SetWithTTL("a", "1", 50);
+        shard.SetWithTTL("a", big, 50);      // reallocated, still scheduled
+        shard.SetWithTTL("b", big, 50);
+        shard.Set("b", "2");                 // reallocated, TTL dropped
+        shard.SetWithTTL("c", "3", 50);
+        shard.Set("c", "4");                 // in place, TTL dropped
+
+        const std::size_t expired =
+            shard.CleanupExpired(common::CoarseClock::Now() + 1000);
+
+        bool correct = expired == 1 && shard.Size() == 2 &&
+                       !shard.Get("a").has_value() &&
+                       shard.Get("b") == std::optional<std::string>("2") &&
+                       shard.Get("c") == std::optional<std::string>("4") &&
+                       shard.LeastRecentKey() == std::optional<std::string>("b");
+
+        return TestResult(
+            "Shard::OverwriteRecord",
+            correct,
+            correct ? "" : "Unexpected state after overwrites"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::OverwriteRecord", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Delete reports whether a live key was removed.
+ */
+TestResult TestShardDeleteResult() {
+    try {
+        core::Shard shard(8);
+        shard.Set("a", "1");
+        shard.SetWithTTL("b", "2", 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        const bool correct = shard.Delete("a") && !shard.Delete("a") &&
+                             !shard.Delete("b") && !shard.Delete("missing") &&
+                             shard.Size() == 0;
+
+        return TestResult(
+            "Shard::DeleteResult",
+            correct,
+            correct ? "" : "Unexpected Delete result"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::DeleteResult", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: A lock-free-read shard behaves like the default one.
+ *
+ * Validates:
+ *  - Overwrites (always a new record), deletes and expiry are visible
+ *  - A key read since it was last passed over gets a second chance
+ *  - Clear unpublishes every key
+ */
+TestResult TestShardLockFreeReads() {
+    try {
+        core::Shard shard(3, core::ReadMode::kLockFree);
+
+        shard.Set("a", "1");
+        shard.Set("b", "2");
+        shard.Set("c", "3");
+        shard.Set("b", "22");                // replaces b's record
+        shard.Get("a");                      // a referenced
+        shard.Set("d", "4");                 // a spared, c evicted
+        shard.SetWithTTL("e", "5", 50);      // b evicted
+
+        bool correct = shard.Size() == 3 &&
+                       shard.Get("a") == std::optional<std::string>("1") &&
+                       !shard.Get("b").has_value() && !shard.Get("c").has_value() &&
+                       shard.Get("d") == std::optional<std::string>("4");
+
+        shard.Delete("d");
+        correct = correct && !shard.Get("d").has_value() &&
+                  shard.CleanupExpired(common::CoarseClock::Now() + 1000) == 1 &&
+                  !shard.Get("e").has_value();
+
+        for (int i = 0; i < 200; ++i) {
+            shard.Set("k" + std::to_string(i % 3), std::to_string(i));
+        }
+        correct = correct && shard.Get("k1") == std::optional<std::string>("199");
+
+        shard.Clear();
+        correct = correct && shard.Size() == 0 && !shard.Get("k1").has_value();
+
+        return TestResult(
+            "Shard::LockFreeReads",
+            correct,
+            correct ? "" : "Unexpected state in lock-free read mode"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::LockFreeReads", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Large values are shared with their record, not copied.
+ *
+ * Validates:
+ *  - GetShared returns a reference to the stored bytes
+ *  - The reference stays valid after the key is overwritten and deleted
+ *  - Small values come back as their own copy
+ */
+TestResult TestShardSharedValue() {
+    try {
+        core::Shard shard(4);
+        const std::string big(core::Record::kSharedValueThreshold, 'v');
+
+        shard.Set("big", big);
+        shard.Set("small", "s");
+
+        auto first = shard.GetShared("big");
+        auto second = shard.GetShared("big");
+        auto small = shard.GetShared("small");
+
+        bool correct = first.has_value() && second.has_value() && small.has_value() &&
+                       first->Data() == second->Data() && first->UseCount() == 3 &&
+                       small->View() == "s" && small->UseCount() == 1;
+
+        shard.Set("big", big);           // replaced, never written in place
+        shard.Delete("big");
+
+        correct = correct && first->View() == big && first->UseCount() == 2 &&
+                  !shard.GetShared("big").has_value();
+
+        return TestResult(
+            "Shard::SharedValue",
+            correct,
+            correct ? "" : "Large value copied or released early"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::SharedValue", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Small blobs live in the handle and survive copies and moves.
+ */
+TestResult TestBlobInline() {
+    try {
+        const std::string tiny(common::Blob::kInlineCapacity, 't');
+        const std::string medium(common::Blob::kInlineCapacity + 1, 'm');
+
+        common::Blob a = common::Blob::Copy(tiny);
+        common::Blob b = a;
+        common::Blob c = std::move(a);
+        common::Blob d = common::Blob::Copy(medium);
+        common::Blob e = d;
+        c.Swap(d);
+
+        bool correct = a.Empty() && b.View() == tiny && b.AllocationSize() == 0 &&
+                       d.View() == tiny && d.Data() != b.Data() &&
+                       c.View() == medium && c.AllocationSize() > 0 && e.UseCount() == 2;
+
+        core::Shard shard(4);
+        shard.Set("small", tiny);
+        auto small = shard.GetShared("small");
+        correct = correct && small.has_value() && small->View() == tiny &&
+                  small->AllocationSize() == 0;
+
+        return TestResult(
+            "Blob::Inline",
+            correct,
+            correct ? "" : "Inline blob lost or shared its bytes"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Blob::Inline", false, ex.what());
+    }
+}
+
+namespace {
+int g_epoch_freed = 0;
+
+void CountingFree(int* object) {
+    delete object;
+    ++g_epoch_freed;
+}
+} // namespace
+
+/**
+ * @brief Test: Retired objects outlive every guard that could see them.
+ *
+ * Validates:
+ *  - Nothing is freed while a guard pinned before the retire is held
+ *  - The object is freed once the guard is released
+ */
+TestResult TestEpochReclamation() {
+    try {
+        g_epoch_freed = 0;
+        core::RetireList retired;
+
+        {
+            core::EpochGuard guard;
+            retired.Retire<int, &CountingFree>(new int(1));
+
+            for (int i = 0; i < 4; ++i) {
+                retired.Reclaim();
+            }
+        }
+        const bool held = g_epoch_freed == 0 && retired.Size() == 1;
+
+        for (int i = 0; i < 4 && retired.Size() != 0; ++i) {
+            retired.Reclaim();
+        }
+
+        bool correct = held && g_epoch_freed == 1 && retired.Size() == 0;
+
+        return TestResult(
+            "Epoch::Reclamation",
+            correct,
+            correct ? "" : "Object freed while pinned, or never freed"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Epoch::Reclamation", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Retired records stay charged until they are freed.
+ *
+ * Validates:
+ *  - Records replaced in lock-free mode still count towards usage
+ *  - ReclaimRetired() frees them without another write and releases them
+ */
+TestResult TestShardRetiredMemory() {
+    try {
+        core::Shard shard(4, core::ReadMode::kLockFree);
+        eviction::MemoryTracker tracker(1ULL << 30);
+        shard.TrackMemory(&tracker);
+
+        const std::string big(core::Record::kSharedValueThreshold, 'v');
+        shard.Set("big", big);
+        const std::size_t live = shard.MemoryUsage().Total();
+
+        for (int i = 0; i < 4; ++i) {
+            shard.Set("big", big);
+        }
+        bool correct = shard.MemoryUsage().Total() >= live + 4 * big.size() &&
+                       tracker.CurrentUsage() == shard.MemoryUsage().Total();
+
+        std::size_t retired = shard.ReclaimRetired();
+        for (int i = 0; i < 4 && retired != 0; ++i) {
+            retired = shard.ReclaimRetired();
+        }
+        correct = correct && retired == 0 && shard.MemoryUsage().Total() == live &&
+                  tracker.CurrentUsage() == live;
+
+        return TestResult(
+            "Shard::RetiredMemory",
+            correct,
+            correct ? "" : "Retired bytes uncounted or never freed"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Shard::RetiredMemory", false, ex.what());
+    }
+}
+
+} // namespace shard_tests
+
+// ============================================================================
+// Test Suite: TTLIndex
+// ============================================================================
+
+namespace ttl_index_tests {
+
+/**
+ * @brief Test: TTLIndex returns keys once they are due.
+ *
+ * Validates:
+ *  - Keys are not returned before their expiry
+ *  - Upsert moves a key to its new expiry; Remove stops tracking it
+ *  - The collection budget leaves the remainder for the next call
+ */
+TestResult TestTTLIndexExpiry() {
+    try {
+        const core::TTLIndex::Timestamp base = 1'700'000'000'000ULL;
+        core::TTLIndex index;
+
+        index.Upsert("a", base + 10);
+        index.Upsert("b", base + 5000);
+        index.Upsert("c", base + 10);
+        index.Upsert("d", base + 10);
+        index.Upsert("c", base + 70'000);   // re-SETEX
+        index.Remove("d");
+
+        bool correct = index.CollectExpired(base + 9).empty() &&
+                       index.CollectExpired(base + 10) == std::vector<std::string>{"a"} &&
+                       index.CollectExpired(base + 69'999) == std::vector<std::string>{"b"} &&
+                       index.Size() == 1;
+
+        for (int i = 0; i < 10; ++i) {
+            index.Upsert("k" + std::to_string(i), base + 80'000);
+        }
+        correct = correct &&
+                  index.CollectExpired(base + 90'000, 4).size() == 4 &&
+                  index.CollectExpired(base + 90'000).size() == 7 &&
+                  index.Size() == 0;
+
+        return TestResult(
+            "TTLIndex::Expiry",
+            correct,
+            correct ? "" : "Keys returned at the wrong time"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("TTLIndex::Expiry", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: TTLIndex agrees with a brute-force model.
+ *
+ * Validates:
+ *  - Random expiries spanning every wheel level are returned exactly
+ *    when due, across cascades and irregular collection times
+ */
+TestResult TestTTLIndexMatchesModel() {
+    try {
+        const core::TTLIndex::Timestamp base = 1'700'000'000'000ULL;
+        core::TTLIndex index;
+        std::unordered_map<std::string, core::TTLIndex::Timestamp> model;
+        std::mt19937_64 rng(11);
+
+        core::TTLIndex::Timestamp now = base;
+        for (int round = 0; round < 3000; ++round) {
+            for (int i = 0; i < 5; ++i) {
+                std::string key = "key" + std::to_string(rng() % 2000);
+                const auto ttl = rng() % (std::uint64_t{1} << (rng() % 34));
+                if (rng() % 4 == 0) {
+                    index.Remove(key);
+                    model.erase(key);
+                } else {
+                    index.Upsert(key, now + ttl);
+                    model[key] = now + ttl;
+                }
+            }
+
+            now += rng() % (std::uint64_t{1} << (rng() % 24));
+
+            auto expired = index.CollectExpired(now);
+            std::sort(expired.begin(), expired.end());
+
+            std::vector<std::string> expected;
+            for (auto it = model.begin(); it != model.end();) {
+                if (it->second <= now) {
+                    expected.push_back(it->first);
+                    it = model.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+
+            if (expired != expected || index.Size() != model.size()) {
+                return TestResult("TTLIndex::MatchesModel", false,
+                                  "Mismatch in round " + std::to_string(round));
+            }
+        }
+
+        return TestResult("TTLIndex::MatchesModel", true);
+    } catch (const std::exception& ex) {
+        return TestResult("TTLIndex::MatchesModel", false, ex.what());
+    }
+}
+
+} // namespace ttl_index_tests
+
+// ============================================================================
+// Test Suite: TTLManager
+// ============================================================================
+
+namespace ttl_manager_tests {
+
+std::unique_ptr<core::KVEngine> MakeEngine(std::size_t shards) {
+    return std::make_unique<core::KVEngine>(
+        std::make_unique<core::ShardManager>(shards, 100'000),
+        std::make_unique<eviction::EvictionManager>(
+            std::make_unique<eviction::MemoryTracker>(1ULL << 30),
+            [] { return std::make_unique<eviction::LRUPolicy>(); }));
+}
+
+/**
+ * @brief Test: An expiry cycle stops at its budget and resumes later.
+ *
+ * Validates:
+ *  - A zero budget still makes progress (one batch) but reports a backlog
+ *  - Later cycles pick up the rest; keys without TTL are untouched
+ */
+TestResult TestTTLManagerCycleBudget() {
+    try {
+        auto engine = MakeEngine(4);
+        for (int i = 0; i < 1000; ++i) {
+            engine->Set("t" + std::to_string(i), "v", 1);
+        }
+        for (int i = 0; i < 10; ++i) {
+            engine->Set("p" + std::to_string(i), "v");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        eviction::TTLManager manager(*engine, std::chrono::milliseconds(100));
+
+        const auto first = manager.RunCycle(eviction::TTLManager::Duration(0));
+        bool correct = !first.complete && first.expired > 0 && first.expired < 1000;
+
+        std::size_t total = first.expired;
+        for (int i = 0; i < 100; ++i) {
+            const auto result = manager.RunCycle(std::chrono::seconds(1));
+            total += result.expired;
+            if (result.complete) {
+                break;
+            }
+        }
+
+        correct = correct && total == 1000 && manager.TotalExpired() == 1000 &&
+                  engine->GetAllKeys().size() == 10;
+
+        return TestResult(
+            "TTLManager::CycleBudget",
+            correct,
+            correct ? "" : "Unexpected expiry progress: " + std::to_string(total)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("TTLManager::CycleBudget", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: The background thread reclaims keys nobody reads.
+ */
+TestResult TestTTLManagerBackground() {
+    try {
+        auto engine = MakeEngine(8);
+        eviction::TTLManager manager(*engine, std::chrono::milliseconds(5));
+        manager.Start();
+
+        for (int i = 0; i < 500; ++i) {
+            engine->Set("k" + std::to_string(i), "v", 10);
+        }
+
+        for (int i = 0; i < 200 && manager.TotalExpired() < 500; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        manager.Stop();
+
+        bool correct = manager.TotalExpired() == 500 && engine->GetAllKeys().empty();
+
+        return TestResult(
+            "TTLManager::Background",
+            correct,
+            correct ? "" : "Expired keys were not reclaimed in the background"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("TTLManager::Background", false, ex.what());
+    }
+}
+
+} // namespace ttl_manager_tests
+
+// ============================================================================
+// Test Suite: Eviction
+// ============================================================================
+
+namespace eviction_tests {
+
+template <typename Policy>
+std::unique_ptr<core::KVEngine> MakeEngine(std::size_t max_memory) {
+    return std::make_unique<core::KVEngine>(
+        std::make_unique<core::ShardManager>(8, 100'000),
+        std::make_unique<eviction::EvictionManager>(
+            std::make_unique<eviction::MemoryTracker>(max_memory, 90, 80, 8),
+            [] { return std::make_unique<Policy>(); },
+            8));
+}
+
+/**
+ * @brief Test: A shard charges and releases every record it holds.
+ *
+ * Validates:
+ *  - Writes, overwrites and capacity evictions change usage
+ *  - Delete, lazy expiry, active expiry and Clear bring it back to zero
+ */
+TestResult TestShardMemoryAccounting() {
+    try {
+        eviction::MemoryTracker tracker(1ULL << 30);
+        core::Shard shard(4);
+        shard.Set("early", "v");
+        shard.TrackMemory(&tracker);
+
+        const std::size_t one = tracker.CurrentUsage();
+        bool correct = one > 0;
+
+        shard.Set("a", std::string(64, 'a'));
+        shard.Set("a", std::string(20'000, 'a'));
+        shard.Set("b", "v");
+        shard.SetWithTTL("c", "v", 1);
+        shard.SetWithTTL("d", "v", 1);
+        correct = correct && shard.Size() == 4 && tracker.CurrentUsage() > 20'000;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        correct = correct && !shard.Get("c").has_value();
+        shard.CleanupExpired(common::CoarseClock::Now());
+        shard.Delete("a");
+        // "early" was evicted for "d"; only "b", the same size, is left.
+        correct = correct && shard.Size() == 1 && tracker.CurrentUsage() == one;
+
+        // Clear() keeps the index table; only it is still charged.
+        shard.Clear();
+        const common::MemoryUsage cleared = shard.MemoryUsage();
+        correct = correct && cleared.key_bytes == 0 && cleared.value_bytes == 0 &&
+                  cleared.overhead_bytes > 0 && tracker.CurrentUsage() == cleared.Total();
+
+        shard.TrackMemory(nullptr);
+        correct = correct && tracker.CurrentUsage() == 0;
+
+        return TestResult(
+            "Eviction::ShardMemoryAccounting",
+            correct,
+            correct ? "" : "Usage left: " + std::to_string(tracker.CurrentUsage())
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::ShardMemoryAccounting", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Usage is split exactly into key, value and overhead bytes.
+ *
+ * Validates:
+ *  - Allocator rounding follows glibc's chunk sizes
+ *  - Key and value bytes match what is stored through every write path
+ *  - The tracker always holds the sum of the shard breakdowns
+ */
+TestResult TestMemoryUsageBreakdown() {
+    try {
+        bool correct = common::AllocatedBytes(0) == 0 && common::AllocatedBytes(1) == 32 &&
+                       common::AllocatedBytes(24) == 32 && common::AllocatedBytes(25) == 48 &&
+                       common::AllocatedBytes(88) == 96 &&
+                       common::AllocatedBytes(200'000) == 200'704;
+
+        for (const auto mode : {core::ReadMode::kShared, core::ReadMode::kLockFree}) {
+            eviction::MemoryTracker tracker(1ULL << 30);
+            core::Shard shard(1000, mode);
+            shard.TrackMemory(&tracker);
+            const std::size_t empty = shard.MemoryUsage().Total();
+
+            shard.Set("key", "value");
+            common::MemoryUsage usage = shard.MemoryUsage();
+            correct = correct && usage.key_bytes == 3 && usage.value_bytes == 5 &&
+                      usage.overhead_bytes >= sizeof(core::Record) &&
+                      tracker.CurrentUsage() == usage.Total();
+
+            // In place (shared mode) or as a replacement record.
+            shard.Set("key", "val");
+            shard.SetWithTTL("big", std::string(100'000, 'b'), 60'000);
+            usage = shard.MemoryUsage();
+            correct = correct && usage.key_bytes == 6 && usage.value_bytes == 100'003 &&
+                      tracker.CurrentUsage() == usage.Total();
+
+            for (int i = 0; i < 100; ++i) {
+                shard.Set("k" + std::to_string(i), std::string(i, 'v'));
+            }
+            for (int i = 0; i < 100; ++i) {
+                shard.Delete("k" + std::to_string(i));
+            }
+            shard.Delete("big");
+            usage = shard.MemoryUsage();
+            correct = correct && usage.key_bytes == 3 && usage.value_bytes == 3 &&
+                      usage.Total() > empty && tracker.CurrentUsage() == usage.Total();
+        }
+
+        auto engine = MakeEngine<eviction::LRUPolicy>(1ULL << 30);
+        for (int i = 0; i < 1000; ++i) {
+            engine->Set("key" + std::to_string(i), std::string(32, 'v'));
+        }
+
+        common::MemoryUsage summed;
+        for (std::size_t i = 0; i < engine->ShardCount(); ++i) {
+            summed += engine->ShardMemoryUsage(i);
+        }
+        const common::MemoryUsage total = engine->MemoryUsage();
+        correct = correct && total.value_bytes == 32'000 && summed.Total() == total.Total() &&
+                  total.key_bytes == summed.key_bytes;
+
+        return TestResult(
+            "Eviction::MemoryUsageBreakdown",
+            correct,
+            correct ? "" : "Memory breakdown does not add up"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::MemoryUsageBreakdown", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Per-partition usage is exact and the aggregate the limits
+ *        read stays within MaxLimit() / kFoldFraction of it.
+ */
+TestResult TestMemoryTrackerPartitions() {
+    try {
+        constexpr std::size_t kPartitions = 4;
+        eviction::MemoryTracker tracker(1 << 20, 90, 80, kPartitions);
+        const std::size_t bound = tracker.MaxLimit() / eviction::MemoryTracker::kFoldFraction;
+
+        for (int i = 0; i < 5; ++i) {
+            tracker.Reserve(1, 100);
+        }
+        bool correct = tracker.CurrentUsage() == 500 && tracker.PartitionUsage(1) == 500 &&
+                       tracker.PartitionUsage(5) == 500 && tracker.AggregateUsage() <= bound;
+
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < kPartitions; ++p) {
+            threads.emplace_back([&tracker, p] {
+                std::mt19937 rng(static_cast<std::uint32_t>(p));
+                std::vector<std::size_t> held;
+                for (int i = 0; i < 20'000; ++i) {
+                    if (held.empty() || rng() % 3 != 0) {
+                        held.push_back(16 + rng() % 400);
+                        tracker.Reserve(p, held.back());
+                    } else {
+                        tracker.Release(p, held.back());
+                        held.pop_back();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        const std::size_t exact = tracker.CurrentUsage();
+        const std::size_t aggregate = tracker.AggregateUsage();
+        correct = correct && exact > tracker.MaxLimit() &&
+                  (aggregate > exact ? aggregate - exact : exact - aggregate) <= bound &&
+                  tracker.IsOverLimit();
+
+        return TestResult(
+            "Eviction::MemoryTrackerPartitions",
+            correct,
+            correct ? "" : "Aggregate " + std::to_string(aggregate) + " vs exact " + std::to_string(exact)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::MemoryTrackerPartitions", false, ex.what());
+    }
+}
+
+/**
+ * @brief Policy that records the keys its partition is told about.
+ */
+class RecordingPolicy final : public eviction::EvictionPolicy {
+    public:
+    void OnRead(std::string_view key) override { seen_.emplace_back(key); }
+    void OnWrite(std::string_view key) override { seen_.emplace_back(key); }
+    void OnDelete(std::string_view key) override { seen_.emplace_back(key); }
+    void Clear() override { seen_.clear(); }
+
+    std::optional<std::string> SelectVictim(const core::ShardManager&, std::size_t) override {
+        if (seen_.empty()) {
+            return std::nullopt;
+        }
+        return seen_.front();
+    }
+
+    std::vector<std::string> seen_;
+};
+
+/**
+ * @brief Test: Each shard's keys reach only that shard's policy instance.
+ */
+TestResult TestEvictionPartitions() {
+    try {
+        constexpr std::size_t kShards = 4;
+        std::vector<RecordingPolicy*> policies;
+
+        auto shards = std::make_unique<core::ShardManager>(kShards, 100'000);
+        core::ShardManager* shard_manager = shards.get();
+        core::KVEngine engine(
+            std::move(shards),
+            std::make_unique<eviction::EvictionManager>(
+                std::make_unique<eviction::MemoryTracker>(1ULL << 30, 90, 80, kShards),
+                [&policies] {
+                    auto policy = std::make_unique<RecordingPolicy>();
+                    policies.push_back(policy.get());
+                    return policy;
+                },
+                kShards));
+
+        for (int i = 0; i < 200; ++i) {
+            engine.Set("k" + std::to_string(i), "v");
+        }
+        engine.Get("k7");
+        engine.Delete("k7");
+        // Nothing removed, so the policies are not told.
+        engine.Delete("k7");
+        engine.Delete("missing");
+
+        bool correct = policies.size() == kShards;
+        std::size_t seen = 0;
+        for (std::size_t p = 0; p < policies.size(); ++p) {
+            for (const auto& key : policies[p]->seen_) {
+                correct = correct && shard_manager->ShardIndex(key) == p;
+            }
+            seen += policies[p]->seen_.size();
+        }
+        correct = correct && seen == 202;
+
+        return TestResult(
+            "Eviction::Partitions",
+            correct,
+            correct ? "" : "A policy saw keys of another shard"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::Partitions", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Without an eviction policy writes are refused at the hard
+ *        limit, and accepted again once memory is freed.
+ */
+TestResult TestEvictionHardLimit() {
+    try {
+        auto engine = MakeEngine<eviction::NoEvictionPolicy>(64 * 1024);
+        const std::string value(1000, 'v');
+
+        int accepted = 0;
+        while (accepted < 1000 && engine->Set("k" + std::to_string(accepted), value) == core::SetResult::kStored) {
+            ++accepted;
+        }
+
+        bool correct = accepted > 40 && accepted < 1000 &&
+                       engine->Set("other", value) == core::SetResult::kOutOfMemory &&
+                       !engine->Get("other").has_value() &&
+                       engine->GetAllKeys().size() == static_cast<std::size_t>(accepted);
+
+        for (int i = 0; i < 10; ++i) {
+            engine->Delete("k" + std::to_string(i));
+        }
+        correct = correct && engine->Set("other", value) == core::SetResult::kStored;
+
+        return TestResult(
+            "Eviction::HardLimit",
+            correct,
+            correct ? "" : "Writes accepted: " + std::to_string(accepted)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::HardLimit", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: Above the high watermark the evictor removes the least
+ *        recently used keys until usage is under the low watermark.
+ */
+TestResult TestEvictorWatermarks() {
+    try {
+        auto engine = MakeEngine<eviction::LRUPolicy>(256 * 1024);
+        eviction::Evictor evictor(*engine, std::chrono::milliseconds(100));
+        const std::string value(1000, 'v');
+
+        int written = 0;
+        bool correct = evictor.RunCycle() == 0;
+        while (!engine->NeedsEviction()) {
+            correct = correct && engine->Set("k" + std::to_string(written++), value) == core::SetResult::kStored;
+        }
+        engine->Get("k0");
+
+        const std::size_t evicted = evictor.RunCycle();
+        const std::size_t live = engine->GetAllKeys().size();
+
+        correct = correct && evicted > 0 && live + evicted == static_cast<std::size_t>(written) &&
+                  !engine->NeedsEviction() && evictor.RunCycle() == 0 &&
+                  engine->Get("k0").has_value() && !engine->Get("k1").has_value();
+
+        return TestResult(
+            "Eviction::EvictorWatermarks",
+            correct,
+            correct ? "" : "Evicted " + std::to_string(evicted) + " of " + std::to_string(written)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::EvictorWatermarks", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: With the evictor running, writing many times the limit
+ *        never reaches the hard limit.
+ */
+TestResult TestEvictorBackground() {
+    try {
+        auto engine = MakeEngine<eviction::LRUPolicy>(1024 * 1024);
+        eviction::Evictor evictor(*engine, std::chrono::milliseconds(1));
+        evictor.Start();
+
+        const std::string value(1000, 'v');
+        bool correct = true;
+        for (int i = 0; i < 10'000; ++i) {
+            correct = correct && engine->Set("k" + std::to_string(i), value) == core::SetResult::kStored;
+            if (i % 100 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        for (int i = 0; i < 200 && engine->NeedsEviction(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        evictor.Stop();
+
+        correct = correct && evictor.TotalEvicted() > 0 && !engine->NeedsEviction() &&
+                  engine->Get("k9999").has_value();
+
+        return TestResult(
+            "Eviction::EvictorBackground",
+            correct,
+            correct ? "" : "Background eviction did not keep memory under the limit"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::EvictorBackground", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: The sampled LRU policy evicts the keys idle the longest,
+ *        while GET hits only stamp their access clocks.
+ */
+TestResult TestSampledLRUPolicy() {
+    try {
+        constexpr std::size_t kShards = 2;
+        core::KVEngine engine(
+            std::make_unique<core::ShardManager>(kShards, 100'000, core::ReadMode::kShared,
+                                                 core::AccessTracking::kSampled),
+            std::make_unique<eviction::EvictionManager>(
+                std::make_unique<eviction::MemoryTracker>(256 * 1024, 90, 80, kShards),
+                // Sampling whole shards makes the choice exact.
+                [] { return std::make_unique<eviction::SampledLRUPolicy>(1000); },
+                kShards));
+        const std::string value(1000, 'v');
+
+        int written = 0;
+        while (!engine.NeedsEviction()) {
+            engine.Set("k" + std::to_string(written++), value);
+        }
+
+        // The first half is read after the writes, so the second half is
+        // idle longer and must go first.
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+        const int hot = written / 2;
+        for (int i = 0; i < hot; ++i) {
+            engine.Get("k" + std::to_string(i));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        const std::size_t evicted = engine.Evict(std::numeric_limits<std::size_t>::max());
+        bool correct = evicted > 0 && evicted < static_cast<std::size_t>(written - hot) &&
+                       !engine.NeedsEviction();
+        for (int i = 0; i < hot; ++i) {
+            correct = correct && engine.Get("k" + std::to_string(i)).has_value();
+        }
+
+        return TestResult(
+            "Eviction::SampledLRUPolicy",
+            correct,
+            correct ? "" : "Evicted " + std::to_string(evicted) + " of " + std::to_string(written)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::SampledLRUPolicy", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: FrequencySketch estimates, saturation and aging.
+ */
+TestResult TestFrequencySketch() {
+    try {
+        eviction::FrequencySketch sketch;
+        const std::size_t hot = 42;
+        const std::size_t warm = 43;
+
+        for (int i = 0; i < 20; ++i) {
+            sketch.Increment(hot);
+        }
+        for (int i = 0; i < 3; ++i) {
+            sketch.Increment(warm);
+        }
+        bool correct = sketch.Frequency(hot) == eviction::FrequencySketch::kMaxFrequency &&
+                       sketch.Frequency(warm) == 3 && sketch.Frequency(44) == 0;
+
+        // 18 counted increments so far; reaching Words() * kSampleFactor
+        // halves every count.
+        const std::size_t reset_at = sketch.Words() * eviction::FrequencySketch::kSampleFactor;
+        for (std::size_t i = 18; i < reset_at; ++i) {
+            sketch.Increment(1000 + i);
+        }
+        correct = correct && sketch.Frequency(hot) == eviction::FrequencySketch::kMaxFrequency / 2;
+
+        return TestResult(
+            "Eviction::FrequencySketch",
+            correct,
+            correct ? "" : "Hot key estimate " + std::to_string(sketch.Frequency(hot))
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::FrequencySketch", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: TinyLFU keeps frequently read keys through a scan of keys
+ *        used once, and refuses a cold key under memory pressure.
+ */
+TestResult TestTinyLFUPolicy() {
+    try {
+        constexpr std::size_t kShards = 2;
+        core::KVEngine engine(
+            std::make_unique<core::ShardManager>(kShards, 100'000, core::ReadMode::kShared,
+                                                 core::AccessTracking::kSampled),
+            std::make_unique<eviction::EvictionManager>(
+                std::make_unique<eviction::MemoryTracker>(256 * 1024, 90, 80, kShards),
+                [] { return std::make_unique<eviction::TinyLFUPolicy>(); },
+                kShards));
+        const std::string value(1000, 'v');
+
+        int written = 0;
+        while (!engine.NeedsEviction()) {
+            engine.Set("k" + std::to_string(written++), value);
+        }
+
+        constexpr int kHot = 20;
+        for (int round = 0; round < 4; ++round) {
+            for (int i = 0; i < kHot; ++i) {
+                engine.Get("k" + std::to_string(i));
+            }
+        }
+
+        // A scan three times the cache, each key written once.
+        for (int i = 0; i < written * 3; ++i) {
+            engine.Set("scan" + std::to_string(i), value);
+            if (engine.NeedsEviction()) {
+                engine.Evict(core::KVEngine::kEvictionBatch);
+            }
+        }
+
+        bool correct = true;
+        for (int i = 0; i < kHot; ++i) {
+            correct = correct && engine.Get("k" + std::to_string(i)).has_value();
+        }
+
+        while (!engine.NeedsEviction()) {
+            engine.Set("fill" + std::to_string(written++), value);
+        }
+        const bool refused = engine.Set("cold", value) == core::SetResult::kNotAdmitted;
+        const bool stored = engine.Get("cold").has_value();
+        correct = correct && refused && !stored;
+
+        return TestResult(
+            "Eviction::TinyLFUPolicy",
+            correct,
+            correct ? "" : (stored || !refused ? "Cold key admitted" : "Hot key evicted by the scan")
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::TinyLFUPolicy", false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: LFUPolicy evicts the least used keys first, and decay lets
+ *        a key that is no longer used fall below new ones.
+ */
+TestResult TestLFUPolicy() {
+    try {
+        constexpr std::size_t kShards = 2;
+        core::KVEngine engine(
+            std::make_unique<core::ShardManager>(kShards, 100'000, core::ReadMode::kShared,
+                                                 core::AccessTracking::kSampled),
+            std::make_unique<eviction::EvictionManager>(
+                std::make_unique<eviction::MemoryTracker>(256 * 1024, 90, 80, kShards),
+                // Every hit counts, no decay.
+                [] { return std::make_unique<eviction::LFUPolicy>(0, 0); },
+                kShards));
+        const std::string value(1000, 'v');
+
+        int written = 0;
+        while (!engine.NeedsEviction()) {
+            engine.Set("k" + std::to_string(written++), value);
+        }
+
+        // The hot half was written first, so LRU would evict it first.
+        const int hot = written / 2;
+        for (int i = 0; i < hot; ++i) {
+            engine.Get("k" + std::to_string(i));
+        }
+
+        const std::size_t evicted = engine.Evict(std::numeric_limits<std::size_t>::max());
+        bool correct = evicted > 0 && !engine.NeedsEviction();
+        for (int i = 0; i < hot; ++i) {
+            correct = correct && engine.Get("k" + std::to_string(i)).has_value();
+        }
+
+        // Idle for 20+ decay periods, "old" drops from 15 to 0.
+        core::ShardManager shards(1, 16);
+        eviction::LFUPolicy decaying(0, 5);
+        decaying.OnWrite("old");
+        for (int i = 0; i < 10; ++i) {
+            decaying.OnRead("old");
+        }
+        correct = correct && decaying.Count("old") == std::uint8_t{15};
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        decaying.OnWrite("new");
+        correct = correct && decaying.SelectVictim(shards, 0) == std::string("old") &&
+                  decaying.Count("old") == std::uint8_t{0};
+
+        return TestResult(
+            "Eviction::LFUPolicy",
+            correct,
+            correct ? "" : "Evicted " + std::to_string(evicted) + " of " + std::to_string(written)
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("Eviction::LFUPolicy", false, ex.what());
+    }
+}
+
+/**
+ * @brief Checks that a policy with per-key state forgets keys removed by
+ *        lazy and active expiry, and that its bytes are charged to the
+ *        memory tracker.
+ */
+template <typename Policy>
+TestResult CheckPolicyExpiry(const std::string& name) {
+    try {
+        Policy* policy = nullptr;
+        auto tracker = std::make_unique<eviction::MemoryTracker>(256 * 1024, 90, 80, 1);
+        eviction::MemoryTracker* memory = tracker.get();
+        core::KVEngine engine(
+            std::make_unique<core::ShardManager>(1, 100'000, core::ReadMode::kShared,
+                                                 core::AccessTracking::kSampled),
+            std::make_unique<eviction::EvictionManager>(
+                std::move(tracker),
+                [&policy] {
+                    auto made = std::make_unique<Policy>();
+                    policy = made.get();
+                    return made;
+                }));
+        const std::string value(1000, 'v');
+
+        constexpr std::size_t kKeys = 40;
+        for (std::size_t i = 0; i < kKeys; ++i) {
+            engine.Set("ttl:" + std::to_string(i), value, 1);
+            engine.Set("live:" + std::to_string(i), value);
+        }
+        const std::size_t charged = policy->MemoryUsage();
+        bool correct = policy->Size() == 2 * kKeys && charged > 0 &&
+                       memory->CurrentUsage() == engine.MemoryUsage().Total();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        correct = correct && !engine.Get("ttl:0").has_value() && policy->Size() == 2 * kKeys - 1;
+
+        engine.ProcessExpired();
+        correct = correct && policy->Size() == kKeys && policy->MemoryUsage() < charged &&
+                  memory->CurrentUsage() == engine.MemoryUsage().Total();
+
+        // Every remaining node is a live key, so every victim is one.
+        int written = 0;
+        while (!engine.NeedsEviction()) {
+            engine.Set("fill:" + std::to_string(written++), value);
+        }
+        engine.Evict(std::numeric_limits<std::size_t>::max());
+        correct = correct && !engine.NeedsEviction() &&
+                  policy->Size() == engine.GetAllKeys().size();
+
+        return TestResult(
+            name,
+            correct,
+            correct ? "" : "Policy tracks " + std::to_string(policy->Size()) + " keys"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult(name, false, ex.what());
+    }
+}
+
+/**
+ * @brief Test: TinyLFU drops expired keys and charges its memory.
+ */
+TestResult TestTinyLFUPolicyExpiry() {
+    return CheckPolicyExpiry<eviction::TinyLFUPolicy>("Eviction::TinyLFUPolicyExpiry");
+}
+
+/**
+ * @brief Test: LFU drops expired keys and charges its memory.
+ */
+TestResult TestLFUPolicyExpiry() {
+    return CheckPolicyExpiry<eviction::LFUPolicy>("Eviction::LFUPolicyExpiry");
+}
+
+} // namespace eviction_tests
+
 // ============================================================================
 // Test Suite: Common (Status)
 // ============================================================================
@@ -682,6 +1976,55 @@ TestResult TestConfigValueMemoryRatio() {
 
 } // namespace config_tests
 
+// ============================================================================
+// Test Suite: Common (Time)
+// ============================================================================
+
+namespace time_tests {
+
+/**
+ * @brief Test: CoarseClock tracks wall time and only moves forward.
+ *
+ * Validates:
+ *  - Without a ticker Now() is close to the system clock and monotonic
+ *  - With a ticker the cached value keeps advancing
+ */
+TestResult TestCoarseClock() {
+    try {
+        const common::EpochMillis wall = common::Clock::NowEpochMillis();
+        common::EpochMillis last = common::CoarseClock::Now();
+
+        bool correct = last + 1000 > wall && wall + 1000 > last;
+        for (int i = 0; i < 1000; ++i) {
+            const common::EpochMillis now = common::CoarseClock::Now();
+            correct = correct && now >= last;
+            last = now;
+        }
+
+        {
+            common::CoarseClock::Ticker ticker;
+            const common::EpochMillis before = common::CoarseClock::Now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            const common::EpochMillis after = common::CoarseClock::Now();
+
+            correct = correct && before >= last && after >= before + 10;
+            last = after;
+        }
+
+        correct = correct && common::CoarseClock::Now() >= last;
+
+        return TestResult(
+            "CoarseClock::Monotonic",
+            correct,
+            correct ? "" : "Coarse clock went backwards or stopped advancing"
+        );
+    } catch (const std::exception& ex) {
+        return TestResult("CoarseClock::Monotonic", false, ex.what());
+    }
+}
+
+} // namespace time_tests
+
 // ============================================================================
 // Main Test Runner
 // ============================================================================
@@ -713,6 +2056,54 @@ void RunAllTests() {
     results.push_back(lru_cache_tests::TestLRUCacheLargeScale());
     results.push_back(lru_cache_tests::TestLRUCacheEmptyAccess());
 
+    // FlatHashMap Tests
+    std::cout << "\nFlatHashMap Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(flat_hash_map_tests::TestFlatHashMapBasicOperations());
+    results.push_back(flat_hash_map_tests::TestFlatHashMapMatchesUnorderedMap());
+    results.push_back(flat_hash_map_tests::TestFlatHashMapFullCollisions());
+
+    // Shard Tests
+    std::cout << "\nShard Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(shard_tests::TestShardLRUEviction());
+    results.push_back(shard_tests::TestShardOverwriteRecord());
+    results.push_back(shard_tests::TestShardDeleteResult());
+    results.push_back(shard_tests::TestShardLockFreeReads());
+    results.push_back(shard_tests::TestEpochReclamation());
+    results.push_back(shard_tests::TestShardRetiredMemory());
+    results.push_back(shard_tests::TestShardSharedValue());
+    results.push_back(shard_tests::TestBlobInline());
+
+    // TTLIndex Tests
+    std::cout << "\nTTLIndex Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(ttl_index_tests::TestTTLIndexExpiry());
+    results.push_back(ttl_index_tests::TestTTLIndexMatchesModel());
+
+    // TTLManager Tests
+    std::cout << "\nTTLManager Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(ttl_manager_tests::TestTTLManagerCycleBudget());
+    results.push_back(ttl_manager_tests::TestTTLManagerBackground());
+
+    // Eviction Tests
+    std::cout << "\nEviction Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(eviction_tests::TestShardMemoryAccounting());
+    results.push_back(eviction_tests::TestMemoryUsageBreakdown());
+    results.push_back(eviction_tests::TestMemoryTrackerPartitions());
+    results.push_back(eviction_tests::TestEvictionPartitions());
+    results.push_back(eviction_tests::TestEvictionHardLimit());
+    results.push_back(eviction_tests::TestEvictorWatermarks());
+    results.push_back(eviction_tests::TestEvictorBackground());
+    results.push_back(eviction_tests::TestSampledLRUPolicy());
+    results.push_back(eviction_tests::TestFrequencySketch());
+    results.push_back(eviction_tests::TestTinyLFUPolicy());
+    results.push_back(eviction_tests::TestTinyLFUPolicyExpiry());
+    results.push_back(eviction_tests::TestLFUPolicy());
+    results.push_back(eviction_tests::TestLFUPolicyExpiry());
+
     // Status Tests
     std::cout << "\nStatus Tests:" << std::endl;
     std::cout << std::string(70, '-') << std::endl;
@@ -733,6 +2124,11 @@ void RunAllTests() {
     results.push_back(config_tests::TestConfigZeroMemory());
     results.push_back(config_tests::TestConfigValueMemoryRatio());
 
+    // Time Tests
+    std::cout << "\nTime Tests:" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    results.push_back(time_tests::TestCoarseClock());
+
     // Report results
     std::cout << std::endl;
     for (const auto& result : results) {
@@ -7,8 +7,10 @@
  * - Request parsing, construction, and edge cases
  * - Response creation and status handling
  * - Buffer operations (append, consume, clear)
+ * - Output queue gathering of pipelined replies
  * - Protocol framing (frame extraction, delimiter handling)
  * - Parser functionality (tokenization, edge cases)
+ * - Binary length-prefixed framing and replies
  * - Serializer output formatting and correctness
  * - Status/Error handling throughout the protocol stack
  * - Concurrency safety assumptions
@@ -25,11 +27,17 @@
 #include <sstream>
 
 #include "../src/protocol/request.h"
+#include "../src/protocol/request_view.h"
 #include "../src/protocol/response.h"
 #include "../src/protocol/buffer.h"
+#include "../src/protocol/binary_framing.h"
+#include "../src/protocol/crlf_search.h"
 #include "../src/protocol/framing.h"
 #include "../src/protocol/parser.h"
+#include "../src/protocol/resp_parser.h"
 #include "../src/protocol/serializer.h"
+#include "../src/net/output_queue.h"
+#include "../src/common/blob.h"
 #include "../src/common/status.h"
 
 using namespace kvmemo;
@@ -399,6 +407,79 @@ void TestBufferAppendAfterConsume() {
     AssertEqual(size_t(9), buf.ReadableBytes(), "Should have 9 bytes (3 + 6)");
 }
 
+/**
+ * ============================================================
+ * OUTPUT QUEUE TESTS
+ * ============================================================
+ */
+
+std::string GatherAll(const net::OutputQueue& queue) {
+    iovec iov[net::OutputQueue::kMaxIovecs];
+    int count = queue.Gather(iov, net::OutputQueue::kMaxIovecs);
+
+    std::string out;
+    for (int i = 0; i < count; ++i) {
+        out.append(static_cast<const char*>(iov[i].iov_base), iov[i].iov_len);
+    }
+    return out;
+}
+
+void TestOutputQueueSmallRepliesShareSegment() {
+    net::OutputQueue queue;
+    queue.Append(std::string("+OK\r\n"));
+    queue.Append(std::string("$1\r\n1\r\n"));
+
+    iovec iov[4];
+    AssertEqual(1, queue.Gather(iov, 4), "Small replies should coalesce into one iovec");
+    AssertEqual("+OK\r\n$1\r\n1\r\n", GatherAll(queue), "Gathered bytes mismatch");
+}
+
+void TestOutputQueueLargeReplySpliced() {
+    net::OutputQueue queue;
+    std::string large(net::OutputQueue::kSpliceThreshold, 'x');
+
+    queue.Append("+OK\r\n", 5);
+    queue.Append(std::move(large));
+    queue.Append("-ERR\r\n", 6);
+
+    iovec iov[4];
+    AssertEqual(3, queue.Gather(iov, 4), "Large reply should be its own segment");
+    AssertEqual(size_t(11) + net::OutputQueue::kSpliceThreshold, queue.ReadableBytes(),
+                "Readable bytes mismatch");
+}
+
+void TestOutputQueueConsumeAcrossSegments() {
+    net::OutputQueue queue;
+    queue.Append("abc", 3);
+    queue.Append(std::string(net::OutputQueue::kSpliceThreshold, 'y'));
+    queue.Append("def", 3);
+
+    queue.Consume(2 + net::OutputQueue::kSpliceThreshold);
+
+    AssertEqual("ydef", GatherAll(queue), "Remaining bytes mismatch");
+    AssertEqual(size_t(4), queue.ReadableBytes(), "Should have 4 bytes left");
+    AssertThrows([&]() { queue.Consume(5); }, "Consuming beyond readable data should throw");
+}
+
+void TestOutputQueueSharedValueReferenced() {
+    net::OutputQueue queue;
+    common::Blob value = common::Blob::Copy(std::string(net::OutputQueue::kSpliceThreshold, 'z'));
+    const char* stored = value.Data();
+
+    queue.Append("$", 1);
+    queue.Append(common::Blob(value));
+    queue.Append(common::Blob::Copy("small"));
+
+    iovec iov[4];
+    AssertEqual(3, queue.Gather(iov, 4), "Large shared value should be its own segment");
+    AssertTrue(iov[1].iov_base == stored, "Shared value should be sent from the stored bytes");
+    AssertEqual(size_t(2), value.UseCount(), "Queue should hold a reference until consumed");
+
+    queue.Consume(1 + net::OutputQueue::kSpliceThreshold);
+    AssertEqual(size_t(1), value.UseCount(), "Consumed segment should drop its reference");
+    AssertEqual("small", GatherAll(queue), "Remaining bytes mismatch");
+}
+
 /**
  * ============================================================
  * FRAMING TESTS - MAJOR & MINOR TEST CASES
@@ -578,6 +659,165 @@ void TestParserTabSeparators() {
     AssertEqual(size_t(2), req.ArgCount(), "Should parse arguments separated by tabs");
 }
 
+void TestParserViewMatchesParse() {
+    const std::string line = "  SET\tkey   value ";
+    RequestView view = Parser::ParseView(line);
+    Request req = Parser::Parse(line);
+
+    AssertEqual(req.Command(), std::string(view.Command()), "Command should match Parse()");
+    AssertEqual(req.ArgCount(), view.ArgCount(), "Argument count should match Parse()");
+    AssertEqual(req.Arg(1), std::string(view.Arg(1)), "Arguments should match Parse()");
+    AssertTrue(view.Arg(0).data() >= line.data() && view.Arg(0).data() < line.data() + line.size(),
+               "Tokens should point into the input");
+}
+
+void TestParserViewManyArguments() {
+    std::string line = "CMD";
+    for (int i = 0; i < 10; ++i) {
+        line += " a" + std::to_string(i);
+    }
+
+    RequestView view = Parser::ParseView(line);
+
+    AssertEqual(size_t(10), view.ArgCount(), "Should spill past the inline arguments");
+    AssertEqual("a9", std::string(view.Arg(9)), "Last argument mismatch");
+    AssertThrows([&]() { view.Arg(10); }, "Out of range argument should throw");
+    AssertThrows([]() { Parser::ParseView(" \t "); }, "Empty command should throw");
+}
+
+void TestFramingPeekDoesNotConsume() {
+    Buffer buf;
+    buf.Append("GET key\r\nPING\r\n");
+
+    std::string_view frame;
+    AssertTrue(Framing::PeekFrame(buf, frame), "Should find frame");
+    AssertEqual("GET key", std::string(frame), "Frame content mismatch");
+    AssertEqual(size_t(15), buf.ReadableBytes(), "Peek should not consume");
+
+    Framing::ConsumeFrame(buf, frame);
+    AssertEqual(size_t(6), buf.ReadableBytes(), "Consume should drop frame and delimiter");
+}
+
+void TestFramingResumesSplitDelimiter() {
+    Buffer buf;
+    buf.Append(std::string(100, 'x') + "\r");
+
+    std::string_view frame;
+    size_t scanned = 0;
+    AssertTrue(!Framing::PeekFrame(buf, frame, scanned), "Frame should be incomplete");
+    AssertEqual(size_t(101), scanned, "Scan offset should cover the searched bytes");
+
+    buf.Append("\nPING\r\n");
+    AssertTrue(Framing::PeekFrame(buf, frame, scanned), "CRLF split across reads should be found");
+    AssertEqual(size_t(100), frame.size(), "Frame should end before the split delimiter");
+}
+
+void TestCrlfSearchKernelsAgree() {
+    std::string data(300, 'a');
+    data[70] = '\r';                 // lone CR
+    data[130] = '\n';                // lone LF
+    data[199] = '\r';
+    data[200] = '\n';
+
+    std::vector<CrlfSearch::Kernel> kernels = {&CrlfSearch::FindScalar, CrlfSearch::Select()};
+#ifdef KVMEMO_CRLF_X86
+    kernels.push_back(&CrlfSearch::FindSse2);
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.push_back(&CrlfSearch::FindAvx2);
+    }
+#endif
+
+    const char *begin = data.data();
+    for (auto kernel : kernels) {
+        for (size_t from = 0; from <= data.size(); ++from) {
+            const char *expected = from <= 200 ? begin + 199 : begin + data.size();
+            AssertTrue(kernel(begin, begin + from, begin + data.size()) == expected,
+                       "Kernel should find the first complete CRLF after the resume point");
+        }
+        AssertTrue(kernel(begin, begin, begin + 200) == begin + 200, "CR without LF is not a delimiter");
+    }
+}
+
+void TestBinaryFramingBinarySafeValue() {
+    const std::string value("a b\r\nc\0d", 9);
+    Buffer buf;
+    buf.Append(BinaryFraming::Encode("SET", "key", value));
+
+    std::string_view body;
+    AssertTrue(BinaryFraming::PeekFrame(buf, body), "Should find binary frame");
+
+    RequestView req = BinaryFraming::Parse(body);
+    AssertEqual("SET", std::string(req.Command()), "Command mismatch");
+    AssertEqual(size_t(2), req.ArgCount(), "Argument count mismatch");
+    AssertEqual(value, std::string(req.Arg(1)), "Value should survive spaces, CRLF and NUL");
+    AssertEqual(buf.ReadableBytes(), BinaryFraming::FrameSize(body), "Frame size mismatch");
+}
+
+void TestBinaryFramingIncompleteFrame() {
+    const std::string frame = BinaryFraming::Encode("GET", "key");
+    Buffer buf;
+    buf.Append(frame.data(), frame.size() - 1);
+
+    std::string_view body;
+    AssertTrue(!BinaryFraming::PeekFrame(buf, body), "Partial frame should wait for more data");
+}
+
+void TestBinaryFramingMalformedFrame() {
+    std::string frame = BinaryFraming::Encode("GET", "key");
+    frame[frame.size() - 4] = 'X';  // corrupt the last field length
+
+    Buffer buf;
+    buf.Append(frame);
+
+    std::string_view body;
+    AssertTrue(BinaryFraming::PeekFrame(buf, body), "Frame should be complete");
+    AssertThrows([&]() { BinaryFraming::Parse(body); }, "Malformed field length should throw");
+}
+
+void TestRespParserMultiBulk() {
+    Buffer buf;
+    buf.Append("*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\na b\r\n\r\n*1\r\n$4\r\nPING\r\n");
+
+    RequestView req;
+    size_t frame_bytes = 0;
+    AssertTrue(RespParser::IsMultiBulk(buf), "Should detect multibulk request");
+    AssertTrue(RespParser::PeekRequest(buf, req, frame_bytes), "Should parse complete request");
+    AssertEqual("SET", std::string(req.Command()), "Command mismatch");
+    AssertEqual(size_t(2), req.ArgCount(), "Argument count mismatch");
+    AssertEqual("a b\r\n", std::string(req.Arg(1)), "Bulk payload should be length delimited");
+    AssertEqual(size_t(33), frame_bytes, "Frame size mismatch");
+}
+
+void TestRespParserIncompleteRequest() {
+    const std::string request = "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n";
+
+    for (size_t len = 1; len < request.size(); ++len) {
+        Buffer buf;
+        buf.Append(request.data(), len);
+
+        RequestView req;
+        size_t frame_bytes = 0;
+        AssertTrue(!RespParser::PeekRequest(buf, req, frame_bytes), "Partial request should wait for more data");
+    }
+}
+
+void TestRespParserMalformedRequest() {
+    RequestView req;
+    size_t frame_bytes = 0;
+
+    Buffer bad_length;
+    bad_length.Append("*1\r\n$x\r\nPING\r\n");
+    AssertThrows([&]() { RespParser::PeekRequest(bad_length, req, frame_bytes); }, "Bad length should throw");
+
+    Buffer bad_terminator;
+    bad_terminator.Append("*1\r\n$4\r\nPINGxx");
+    AssertThrows([&]() { RespParser::PeekRequest(bad_terminator, req, frame_bytes); }, "Missing CRLF should throw");
+
+    Buffer empty;
+    empty.Append("*0\r\n");
+    AssertThrows([&]() { RespParser::PeekRequest(empty, req, frame_bytes); }, "Empty multibulk should throw");
+}
+
 /**
  * ============================================================
  * SERIALIZER TESTS - MAJOR & MINOR TEST CASES
@@ -598,6 +838,31 @@ void TestSerializerOkResponseWithMessage() {
     AssertEqual("$7\r\nSuccess\r\n", serialized, "Bulk string serialization mismatch");
 }
 
+void TestSerializerSharedValueMatchesMessage() {
+    const std::string value = "Success";
+
+    AssertEqual(Serializer::Serialize(Response::Ok(value)),
+                Serializer::Serialize(Response::Value(common::Blob::Copy(value))),
+                "Text reply for a shared value mismatch");
+    AssertEqual(Serializer::SerializeBinary(Response::Ok(value)),
+                Serializer::SerializeBinary(Response::Value(common::Blob::Copy(value))),
+                "Binary reply for a shared value mismatch");
+    AssertEqual(Serializer::SerializeResp(Response::Ok(value)),
+                Serializer::SerializeResp(Response::Value(common::Blob::Copy(value))),
+                "RESP reply for a shared value mismatch");
+}
+
+void TestSerializerEmptyValue() {
+    // A stored empty value is a zero-length value, not an OK status.
+    const Response empty = Response::Value(common::Blob::Copy(""));
+
+    AssertEqual("$0\r\n\r\n", Serializer::Serialize(empty), "Text reply for an empty value mismatch");
+    AssertEqual(std::string("$\0\0\0\0", 5), Serializer::SerializeBinary(empty),
+                "Binary reply for an empty value mismatch");
+    AssertEqual("$0\r\n\r\n", Serializer::SerializeResp(empty), "RESP reply for an empty value mismatch");
+    AssertEqual("+OK\r\n", Serializer::SerializeResp(Response::Ok()), "RESP OK reply mismatch");
+}
+
 void TestSerializerErrorResponse() {
     Response resp = Response::Error("Key not found");
     std::string serialized = Serializer::Serialize(resp);
@@ -665,6 +930,42 @@ void TestSerializerResponseStatus() {
     AssertTrue(err_ser[0] == '-', "Error response should start with -");
 }
 
+void TestSerializerAppendsIntoBuffer() {
+    Buffer buf;
+    Serializer::AppendText(Response::Ok(), buf);
+    Serializer::AppendText(Response::Ok("Alice"), buf);
+    Serializer::AppendText(Response::Error("Key not found"), buf);
+    AssertEqual("+OK\r\n$5\r\nAlice\r\n-ERRKey not found\r\n", std::string(buf.Data(), buf.ReadableBytes()),
+                "Appended replies should match Serialize()");
+
+    // Large payloads are moved into the output queue rather than copied.
+    net::OutputQueue queue;
+    Serializer::AppendText(Response::Ok(std::string(net::OutputQueue::kSpliceThreshold, 'v')), queue);
+
+    iovec iov[4];
+    AssertEqual(3, queue.Gather(iov, 4), "Header, payload and CRLF should be separate segments");
+    AssertEqual(net::OutputQueue::kSpliceThreshold, iov[1].iov_len, "Payload segment size mismatch");
+}
+
+void TestSerializerRespReplies() {
+    AssertEqual("$-1\r\n", Serializer::SerializeResp(Response::Null("Key not found")),
+                "Miss should be a null bulk reply");
+    AssertEqual(":1\r\n", Serializer::SerializeResp(Response::Integer(1)), "Integer reply mismatch");
+    AssertEqual("-ERR bad\r\n", Serializer::SerializeResp(Response::Error("bad")), "Error reply mismatch");
+    AssertEqual("$2\r\nhi\r\n", Serializer::SerializeResp(Response::Ok("hi")), "Bulk reply mismatch");
+    AssertEqual("-ERRKey not found\r\n", Serializer::Serialize(Response::Null("Key not found")),
+                "Text replies should be unchanged");
+}
+
+void TestSerializerBinaryReplies() {
+    AssertEqual(std::string("+\0\0\0\0", 5), Serializer::SerializeBinary(Response::Ok()),
+                "Empty success should be type + with no payload");
+    AssertEqual(std::string("$\0\0\0\x02" "hi", 7), Serializer::SerializeBinary(Response::Ok("hi")),
+                "Payload should be length prefixed");
+    AssertEqual(std::string("-\0\0\0\x03" "bad", 8), Serializer::SerializeBinary(Response::Error("bad")),
+                "Error should be type -");
+}
+
 /**
  * ============================================================
  * STATUS / ERROR HANDLING TESTS
@@ -858,6 +1159,10 @@ int main() {
     runner.Run("TestBufferLargeBinaryData", TestBufferLargeBinaryData);
     runner.Run("TestBufferReusageAfterClear", TestBufferReusageAfterClear);
     runner.Run("TestBufferAppendAfterConsume", TestBufferAppendAfterConsume);
+    runner.Run("TestOutputQueueSmallRepliesShareSegment", TestOutputQueueSmallRepliesShareSegment);
+    runner.Run("TestOutputQueueLargeReplySpliced", TestOutputQueueLargeReplySpliced);
+    runner.Run("TestOutputQueueConsumeAcrossSegments", TestOutputQueueConsumeAcrossSegments);
+    runner.Run("TestOutputQueueSharedValueReferenced", TestOutputQueueSharedValueReferenced);
 
     // FRAMING TESTS
     std::cout << "\n>>> FRAMING TESTS <<<" << std::endl;
@@ -883,11 +1188,24 @@ int main() {
     runner.Run("TestParserSpecialCharactersInArguments", TestParserSpecialCharactersInArguments);
     runner.Run("TestParserLargeCommandLine", TestParserLargeCommandLine);
     runner.Run("TestParserTabSeparators", TestParserTabSeparators);
+    runner.Run("TestParserViewMatchesParse", TestParserViewMatchesParse);
+    runner.Run("TestParserViewManyArguments", TestParserViewManyArguments);
+    runner.Run("TestFramingPeekDoesNotConsume", TestFramingPeekDoesNotConsume);
+    runner.Run("TestBinaryFramingBinarySafeValue", TestBinaryFramingBinarySafeValue);
+    runner.Run("TestBinaryFramingIncompleteFrame", TestBinaryFramingIncompleteFrame);
+    runner.Run("TestFramingResumesSplitDelimiter", TestFramingResumesSplitDelimiter);
+    runner.Run("TestCrlfSearchKernelsAgree", TestCrlfSearchKernelsAgree);
+    runner.Run("TestBinaryFramingMalformedFrame", TestBinaryFramingMalformedFrame);
+    runner.Run("TestRespParserMultiBulk", TestRespParserMultiBulk);
+    runner.Run("TestRespParserIncompleteRequest", TestRespParserIncompleteRequest);
+    runner.Run("TestRespParserMalformedRequest", TestRespParserMalformedRequest);
 
     // SERIALIZER TESTS
     std::cout << "\n>>> SERIALIZER TESTS <<<" << std::endl;
     runner.Run("TestSerializerOkResponseEmpty", TestSerializerOkResponseEmpty);
     runner.Run("TestSerializerOkResponseWithMessage", TestSerializerOkResponseWithMessage);
+    runner.Run("TestSerializerSharedValueMatchesMessage", TestSerializerSharedValueMatchesMessage);
+    runner.Run("TestSerializerEmptyValue", TestSerializerEmptyValue);
     runner.Run("TestSerializerErrorResponse", TestSerializerErrorResponse);
     runner.Run("TestSerializerBulkStringLength", TestSerializerBulkStringLength);
     runner.Run("TestSerializerBulkStringEmpty", TestSerializerBulkStringEmpty);
@@ -896,6 +1214,9 @@ int main() {
     runner.Run("TestSerializerLongMessage", TestSerializerLongMessage);
     runner.Run("TestSerializerCRLFEncoding", TestSerializerCRLFEncoding);
     runner.Run("TestSerializerResponseStatus", TestSerializerResponseStatus);
+    runner.Run("TestSerializerAppendsIntoBuffer", TestSerializerAppendsIntoBuffer);
+    runner.Run("TestSerializerRespReplies", TestSerializerRespReplies);
+    runner.Run("TestSerializerBinaryReplies", TestSerializerBinaryReplies);
 
     // STATUS / ERROR HANDLING TESTS
     std::cout << "\n>>> STATUS / ERROR HANDLING TESTS <<<" << std::endl;